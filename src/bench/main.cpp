@@ -0,0 +1,711 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include "../core/luna.h"
+
+#define BENCH_ARRAY_ELEMENTS 1000000
+#define BENCH_FORK_GLOBALS 0x400
+#define BENCH_FORK_INSTANCES 0x200
+#define BENCH_HEAP_OBJECTS 0x40000
+#define BENCH_HEAP_PAUSE_BUDGET 200
+#define BENCH_HEAP_TRIGGER_RATIO 2.0
+#define BENCH_IMAGE_DIRECTORY "."
+#define BENCH_IMAGE_SCRIPT "./luna_bench.lu"
+#define BENCH_IMAGE_STATEMENTS 50000
+#define BENCH_ITERATIONS 0x40000
+#define BENCH_LEXER_TOKENS 100000
+#define BENCH_PARSER_PASSES 0x10
+#define BENCH_PARSER_STATEMENTS 10000
+#define BENCH_SCOPE_LOOKUPS 0x100000
+#define BENCH_STRUCTURE_FIELDS 0x08
+#define BENCH_STRUCTURE_LITERALS 0x10000
+#define BENCH_THREADS 0x04
+#define BENCH_VALUE_OPERATIONS 0x100000
+
+typedef std::chrono::high_resolution_clock bench_clock_t;
+
+static heap_stats_t bench_heap_total = heap_stats_t();
+
+double 
+bench_elapsed(
+	__in const bench_clock_t::time_point &begin
+	)
+{
+	return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+		bench_clock_t::now() - begin).count();
+}
+
+void 
+bench_array(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	double total = 0;
+	symbol_array_ptr arr_copy;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+
+	{
+		symbol_array arr(NULL, "array");
+
+		begin = bench_clock_t::now();
+
+		for(iter = 0; iter < BENCH_ARRAY_ELEMENTS; ++iter) {
+			arr.add_element(value((double) iter));
+		}
+
+		std::cout << "array (" << arr.size() << " floats, append): " << bench_elapsed(begin) 
+			<< " ms, " << arr.get_store_size() << " bytes" << std::endl;
+
+		begin = bench_clock_t::now();
+
+		for(iter = 0; iter < BENCH_ARRAY_ELEMENTS; ++iter) {
+			total += arr.get_element(iter).as_float();
+		}
+
+		std::cout << "array (" << arr.size() << " floats, read): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+
+		begin = bench_clock_t::now();
+		arr_copy = new symbol_array(arr);
+		std::cout << "array (" << arr_copy->size() << " floats, copy): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+
+		begin = bench_clock_t::now();
+		arr_copy->set_element(value(0.0), 0);
+		std::cout << "array (" << arr_copy->size() << " floats, first write after copy): " 
+			<< bench_elapsed(begin) << " ms" << std::endl;
+		delete arr_copy;
+
+		arr.set_element(value(true), 0);
+		std::cout << "array (" << arr.size() << " elements, boxed): " << arr.get_store_size() 
+			<< " bytes" << std::endl;
+	}
+
+	if(total != ((double) BENCH_ARRAY_ELEMENTS * (BENCH_ARRAY_ELEMENTS - 1) / 2)) {
+		std::cerr << "array read mismatch: " << total << std::endl;
+	}
+
+	inst->destroy();
+}
+
+void 
+bench_fork(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	std::string key;
+	scope_shared_t prelude;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+	prelude = scope_shared_t(new scope);
+
+	for(iter = 0; iter < BENCH_FORK_GLOBALS; ++iter) {
+		std::stringstream stream;
+
+		stream << "global_" << iter;
+		prelude->add_symbol_integer(stream.str(), iter);
+	}
+
+	prelude->freeze();
+	key = "global_0";
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_FORK_INSTANCES; ++iter) {
+		scope scop;
+
+		scop.copy_symbols(*prelude);
+		((symbol_integer_ptr) scop.detach_symbol(key))->set_value(iter);
+	}
+
+	std::cout << "fork (" << BENCH_FORK_INSTANCES << " instances, " << BENCH_FORK_GLOBALS 
+		<< " globals, full copy): " << bench_elapsed(begin) << " ms" << std::endl;
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_FORK_INSTANCES; ++iter) {
+		scope scop;
+
+		scop.set_base(prelude);
+		((symbol_integer_ptr) scop.detach_symbol(key))->set_value(iter);
+	}
+
+	std::cout << "fork (" << BENCH_FORK_INSTANCES << " instances, " << BENCH_FORK_GLOBALS 
+		<< " globals, copy-on-write): " << bench_elapsed(begin) << " ms" << std::endl;
+
+	if(((symbol_integer_ptr) prelude->get_symbol(key))->get_value()) {
+		std::cerr << "fork prelude mutated: " << prelude->to_string() << std::endl;
+	}
+
+	prelude.reset();
+	inst->destroy();
+}
+
+void 
+bench_heap_collect(
+	__in const heap_stats_t &stats
+	)
+{
+	++bench_heap_total.collections;
+	bench_heap_total.duration += stats.duration;
+	bench_heap_total.objects_promoted += stats.objects_promoted;
+	bench_heap_total.steps += stats.steps;
+}
+
+void 
+bench_heap_overrun(
+	__in double pause,
+	__in uint32_t pause_budget
+	)
+{
+	UNREF_PARAM(pause_budget);
+
+	bench_heap_total.pause_max = std::max(bench_heap_total.pause_max, pause);
+	++bench_heap_total.steps_over_budget;
+}
+
+void 
+bench_heap(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	heap_ptr hp = NULL;
+	heap_stats_t stats;
+	bench_clock_t::time_point begin;
+	symbol_structure_ptr first = NULL, second = NULL;
+
+	inst->initialize();
+	inst->set_heap_pause_budget(BENCH_HEAP_PAUSE_BUDGET);
+	inst->set_heap_trigger_ratio(BENCH_HEAP_TRIGGER_RATIO);
+	inst->set_heap_callback(bench_heap_collect);
+	inst->set_heap_overrun_callback(bench_heap_overrun);
+	hp = inst->acquire_heap();
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_HEAP_OBJECTS; ++iter) {
+		second = (symbol_structure_ptr) hp->allocate(SCOPE_SYMBOL_STRUCTURE);
+
+		if(first) {
+			first->add_value("next", second->get_id());
+			second->add_value("next", first->get_id());
+			hp->remove_root(first);
+			first = NULL;
+		} else {
+			first = second;
+			hp->add_root(first);
+		}
+	}
+
+	stats = inst->get_heap_stats();
+	std::cout << "heap (" << BENCH_HEAP_OBJECTS << " cyclic objects, " << BENCH_HEAP_PAUSE_BUDGET 
+		<< " us budget): " << bench_elapsed(begin) << " ms, " << hp->get_collection_count() 
+		<< " collections, " << hp->size() << " live" << std::endl;
+	std::cout << "heap (last collection): " << stats.duration << " us over " << stats.steps 
+		<< " steps (" << stats.steps_over_budget << " over budget), max step " << stats.pause_max 
+		<< " us, " << stats.bytes_reclaimed << " bytes reclaimed, " << stats.bytes_live 
+		<< " bytes live, " << stats.objects_promoted << " promoted" << std::endl;
+	std::cout << "heap (all collections): " << bench_heap_total.steps << " steps, " 
+		<< bench_heap_total.steps_over_budget << " over budget";
+
+	if(bench_heap_total.steps_over_budget) {
+		std::cout << " (worst " << bench_heap_total.pause_max << " us)";
+	}
+
+	std::cout << ", " << bench_heap_total.objects_promoted << " promoted" << std::endl;
+
+	begin = bench_clock_t::now();
+	hp->collect();
+	std::cout << "heap (full collect): " << bench_elapsed(begin) << " ms, " << hp->size() 
+		<< " live, " << hp->get_bytes() << " bytes" << std::endl;
+
+	inst->destroy();
+}
+
+void 
+bench_image(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	std::ofstream file;
+	std::string path;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+
+	file.open(BENCH_IMAGE_SCRIPT, std::ios::out | std::ios::trunc);
+
+	for(iter = 0; iter < BENCH_IMAGE_STATEMENTS; ++iter) {
+		file << "ident_" << iter << " = (" << iter << " + ident_" << iter << ") * 2;" << std::endl;
+	}
+
+	file.close();
+
+	{
+		parser par(BENCH_IMAGE_SCRIPT, true);
+
+		begin = bench_clock_t::now();
+		par.discover();
+		std::cout << "image (" << par.size() << " statements, cold parse): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+
+		path = par.save_image(BENCH_IMAGE_DIRECTORY);
+	}
+
+	{
+		parser par(BENCH_IMAGE_SCRIPT, true);
+
+		begin = bench_clock_t::now();
+		if(par.load_image(BENCH_IMAGE_DIRECTORY)) {
+			std::cout << "image (" << par.size() << " statements, mmap load): " << bench_elapsed(begin) 
+				<< " ms" << std::endl;
+		}
+	}
+
+	std::remove(path.c_str());
+	std::remove(BENCH_IMAGE_SCRIPT);
+	inst->destroy();
+}
+
+void 
+bench_lexer(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	std::stringstream input;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+
+	for(iter = 0; iter < (BENCH_LEXER_TOKENS / 2); ++iter) {
+		input << "ident_" << iter << " " << iter << std::endl;
+	}
+
+	begin = bench_clock_t::now();
+
+	{
+		lexer lex(input.str());
+		lex.discover();
+		std::cout << "lexer (" << lex.size() << " tokens): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+	}
+
+	inst->destroy();
+}
+
+void 
+bench_parser(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	std::stringstream input;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+
+	for(iter = 0; iter < BENCH_PARSER_STATEMENTS; ++iter) {
+		input << "ident_" << iter << " = (" << iter << " + ident_" << iter << ") * 2;" << std::endl;
+	}
+
+	{
+		parser par(input.str());
+
+		begin = bench_clock_t::now();
+		par.discover();
+		std::cout << "parser (" << par.size() << " statements, first pass): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+
+		begin = bench_clock_t::now();
+
+		for(iter = 0; iter < BENCH_PARSER_PASSES; ++iter) {
+			par.set(input.str());
+			par.discover();
+		}
+
+		std::cout << "parser (" << par.size() << " statements, reparse): " 
+			<< (bench_elapsed(begin) / BENCH_PARSER_PASSES) << " ms/pass" << std::endl;
+	}
+
+	inst->destroy();
+}
+
+void 
+bench_scope(
+	__in luna_ptr inst,
+	__in size_t count
+	)
+{
+	size_t iter;
+	std::vector<atom_t> atom_list;
+	std::vector<std::string> key_list;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+
+	{
+		scope scop;
+
+		for(iter = 0; iter < count; ++iter) {
+			std::stringstream key;
+
+			key << "sym_" << iter;
+			key_list.push_back(key.str());
+			scop.add_symbol_integer(key.str(), iter);
+			atom_list.push_back(scop.get_symbol(key.str())->get_key_atom());
+		}
+
+		begin = bench_clock_t::now();
+
+		for(iter = 0; iter < BENCH_SCOPE_LOOKUPS; ++iter) {
+			scop.get_symbol(key_list.at(iter % count));
+		}
+
+		std::cout << "scope get_symbol (" << count << " symbols, string key): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+
+		begin = bench_clock_t::now();
+
+		for(iter = 0; iter < BENCH_SCOPE_LOOKUPS; ++iter) {
+			scop.get_symbol(atom_list.at(iter % count));
+		}
+
+		std::cout << "scope get_symbol (" << count << " symbols, atom key): " << bench_elapsed(begin) 
+			<< " ms" << std::endl;
+	}
+
+	inst->destroy();
+}
+
+void 
+bench_structure(
+	__in luna_ptr inst
+	)
+{
+	uuid id;
+	size_t field, iter;
+	bench_clock_t::time_point begin;
+	std::vector<atom_t> field_list;
+	std::vector<shape_cache_t> cache_list;
+	std::vector<symbol_structure_ptr> struct_list;
+
+	inst->initialize();
+
+	for(field = 0; field < BENCH_STRUCTURE_FIELDS; ++field) {
+		std::stringstream key;
+
+		key << "field_" << field;
+		field_list.push_back(inst->acquire_atom_factory()->generate(key.str()));
+		cache_list.push_back(shape_cache_t());
+		cache_list.back().layout = NULL;
+		cache_list.back().slot = SHAPE_SLOT_NONE;
+	}
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_STRUCTURE_LITERALS; ++iter) {
+		struct_list.push_back(new symbol_structure(NULL, "struct"));
+
+		for(field = 0; field < BENCH_STRUCTURE_FIELDS; ++field) {
+			struct_list.back()->add_value(field_list.at(field), id);
+		}
+	}
+
+	std::cout << "structure (" << struct_list.size() << " literals, " << BENCH_STRUCTURE_FIELDS 
+		<< " fields, build): " << bench_elapsed(begin) << " ms, " 
+		<< inst->acquire_shape_factory()->size() << " shapes" << std::endl;
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < struct_list.size(); ++iter) {
+
+		for(field = 0; field < BENCH_STRUCTURE_FIELDS; ++field) {
+			struct_list.at(iter)->get_value(field_list.at(field));
+		}
+	}
+
+	std::cout << "structure (" << struct_list.size() << " literals, " << BENCH_STRUCTURE_FIELDS 
+		<< " fields, read): " << bench_elapsed(begin) << " ms" << std::endl;
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < struct_list.size(); ++iter) {
+
+		for(field = 0; field < BENCH_STRUCTURE_FIELDS; ++field) {
+			struct_list.at(iter)->get_value(field_list.at(field), cache_list.at(field));
+		}
+	}
+
+	std::cout << "structure (" << struct_list.size() << " literals, " << BENCH_STRUCTURE_FIELDS 
+		<< " fields, cached read): " << bench_elapsed(begin) << " ms" << std::endl;
+
+	for(iter = 0; iter < struct_list.size(); ++iter) {
+		delete struct_list.at(iter);
+	}
+
+	inst->destroy();
+}
+
+void 
+bench_uuid_generator_worker(
+	__in uuid_factory_ptr fact,
+	__in size_t count
+	)
+{
+	size_t iter;
+	std::vector<uuid> id_list;
+
+	for(iter = 0; iter < count; ++iter) {
+		id_list.push_back(fact->generate(true));
+	}
+
+	for(iter = 0; iter < count; ++iter) {
+		fact->unregister_id(id_list.at(iter));
+	}
+}
+
+void 
+bench_uuid_generator(
+	__in luna_ptr inst,
+	__in uuid_gen_t generator,
+	__in const std::string &name
+	)
+{
+	size_t iter;
+	bench_clock_t::time_point begin;
+	std::vector<std::thread> thread_list;
+
+	inst->initialize(UUID_REGISTRY_SHARDED, generator);
+
+	begin = bench_clock_t::now();
+	bench_uuid_generator_worker(inst->acquire_uuid_factory(), BENCH_ITERATIONS);
+	std::cout << "uuid generator (" << name << ", 1 thread): " << bench_elapsed(begin) 
+		<< " ms" << std::endl;
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_THREADS; ++iter) {
+		thread_list.push_back(std::thread(bench_uuid_generator_worker, 
+			inst->acquire_uuid_factory(), BENCH_ITERATIONS / BENCH_THREADS));
+	}
+
+	for(iter = 0; iter < thread_list.size(); ++iter) {
+		thread_list.at(iter).join();
+	}
+
+	std::cout << "uuid generator (" << name << ", " << BENCH_THREADS << " threads): " 
+		<< bench_elapsed(begin) << " ms" << std::endl;
+
+	inst->destroy();
+}
+
+void 
+bench_uuid_range(
+	__in luna_ptr inst,
+	__in uuid_reg_t registry,
+	__in const std::string &name
+	)
+{
+	uuid id;
+	size_t iter;
+	uuid_factory_ptr fact;
+	std::vector<uuid> id_list;
+	bench_clock_t::time_point begin;
+
+	inst->initialize(registry);
+	fact = inst->acquire_uuid_factory();
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_ITERATIONS; ++iter) {
+		id_list.push_back(fact->generate());
+	}
+
+	for(iter = 0; iter < BENCH_ITERATIONS; ++iter) {
+		fact->unregister_id(id_list.at(iter));
+	}
+
+	std::cout << "uuid range (" << name << ", single): " << bench_elapsed(begin) 
+		<< " ms" << std::endl;
+
+	begin = bench_clock_t::now();
+	id = fact->generate_range(BENCH_ITERATIONS);
+	fact->unregister_range(id, BENCH_ITERATIONS);
+	std::cout << "uuid range (" << name << ", batch): " << bench_elapsed(begin) 
+		<< " ms" << std::endl;
+
+	inst->destroy();
+}
+
+void 
+bench_uuid_registry_worker(
+	__in uuid_factory_ptr fact,
+	__in size_t count
+	)
+{
+	size_t iter;
+	std::vector<uuid> id_list;
+
+	for(iter = 0; iter < count; ++iter) {
+		id_list.push_back(fact->generate());
+	}
+
+	for(iter = 0; iter < count; ++iter) {
+		fact->register_id(id_list.at(iter));
+		fact->get_reference_count(id_list.at(iter));
+	}
+
+	for(iter = 0; iter < count; ++iter) {
+		fact->unregister_id(id_list.at(iter));
+		fact->unregister_id(id_list.at(iter));
+	}
+}
+
+void 
+bench_uuid_registry(
+	__in luna_ptr inst,
+	__in uuid_reg_t registry,
+	__in const std::string &name
+	)
+{
+	size_t iter;
+	bench_clock_t::time_point begin;
+	std::vector<std::thread> thread_list;
+
+	inst->initialize(registry);
+
+	begin = bench_clock_t::now();
+	bench_uuid_registry_worker(inst->acquire_uuid_factory(), BENCH_ITERATIONS);
+	std::cout << "uuid registry (" << name << ", 1 thread): " << bench_elapsed(begin) 
+		<< " ms" << std::endl;
+
+	begin = bench_clock_t::now();
+
+	for(iter = 0; iter < BENCH_THREADS; ++iter) {
+		thread_list.push_back(std::thread(bench_uuid_registry_worker, 
+			inst->acquire_uuid_factory(), BENCH_ITERATIONS / BENCH_THREADS));
+	}
+
+	for(iter = 0; iter < thread_list.size(); ++iter) {
+		thread_list.at(iter).join();
+	}
+
+	std::cout << "uuid registry (" << name << ", " << BENCH_THREADS << " threads): " 
+		<< bench_elapsed(begin) << " ms" << std::endl;
+
+	inst->destroy();
+}
+
+void 
+bench_value(
+	__in luna_ptr inst
+	)
+{
+	size_t iter;
+	value val_result;
+	symbol_integer_ptr sym_next, sym_result;
+	bench_clock_t::time_point begin;
+
+	inst->initialize();
+
+	begin = bench_clock_t::now();
+	sym_result = new symbol_integer(NULL, "result");
+
+	for(iter = 0; iter < BENCH_VALUE_OPERATIONS; ++iter) {
+		sym_next = new symbol_integer(NULL, "result", sym_result->get_value() + (int) iter);
+		delete sym_result;
+		sym_result = sym_next;
+	}
+
+	std::cout << "value arithmetic (" << BENCH_VALUE_OPERATIONS << " operations, symbol): " 
+		<< bench_elapsed(begin) << " ms" << std::endl;
+
+	begin = bench_clock_t::now();
+	val_result = value(0);
+
+	for(iter = 0; iter < BENCH_VALUE_OPERATIONS; ++iter) {
+		val_result = val_result.add(value((int) iter));
+	}
+
+	std::cout << "value arithmetic (" << BENCH_VALUE_OPERATIONS << " operations, boxed): " 
+		<< bench_elapsed(begin) << " ms" << std::endl;
+
+	if(val_result.as_integer() != sym_result->get_value()) {
+		std::cerr << "value arithmetic mismatch: " << val_result.to_string() << std::endl;
+	}
+
+	delete sym_result;
+	inst->destroy();
+}
+
+int
+main(void) 
+{
+	int result = 0;
+	luna_ptr inst = NULL;
+
+	TRACE_ENTRY();
+
+	std::cout << luna::version(true, true, true) << std::endl << "---" << std::endl;
+
+	try {
+
+		inst = luna::acquire();
+		if(!inst) {
+			result = 1;
+			goto exit;
+		}
+
+		bench_uuid_registry(inst, UUID_REGISTRY_MAP, "map");
+		bench_uuid_registry(inst, UUID_REGISTRY_SHARDED, "sharded");
+		bench_uuid_generator(inst, UUID_GENERATOR_RANDOM, "random");
+		bench_uuid_generator(inst, UUID_GENERATOR_SEQUENTIAL, "sequential");
+		bench_uuid_range(inst, UUID_REGISTRY_MAP, "map");
+		bench_uuid_range(inst, UUID_REGISTRY_SHARDED, "sharded");
+		bench_lexer(inst);
+		bench_array(inst);
+		bench_fork(inst);
+		bench_heap(inst);
+		bench_image(inst);
+		bench_parser(inst);
+		bench_scope(inst, 10);
+		bench_scope(inst, 1000);
+		bench_scope(inst, 100000);
+		bench_structure(inst);
+		bench_value(inst);
+	} catch(std::runtime_error &exc) {
+		std::cerr << exc.what() << std::endl;
+		result = 1;
+	}
+
+exit:
+	TRACE_EXIT("Return Value: 0x%x", result);
+	return result;
+}
@@ -44,9 +44,12 @@ namespace LUNA_NS {
 	_luna::_luna(
 		__in_opt generic_cb_t dest
 		) :
+			m_atom_factory(atom_factory::acquire()),
+			m_heap(heap::acquire()),
 			m_initialized(false),
 			m_node_factory(node_factory::acquire()),
 			m_scope_factory(scope_factory::acquire()),
+			m_shape_factory(shape_factory::acquire()),
 			m_token_factory(token_factory::acquire()),
 			m_uuid_factory(uuid_factory::acquire())
 	{
@@ -97,6 +100,48 @@ namespace LUNA_NS {
 		return result;
 	}
 
+	atom_factory_ptr 
+	_luna::acquire_atom_factory(void)
+	{
+		atom_factory_ptr result = NULL;
+
+		TRACE_ENTRY();
+
+		if(!m_initialized) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_UNINITIALIZED);
+		}
+
+		if(!m_atom_factory) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_UNINITIALIZED);
+		}
+
+		result = m_atom_factory;
+
+		TRACE_EXIT("Return Value: 0x%p", result);
+		return result;
+	}
+
+	heap_ptr 
+	_luna::acquire_heap(void)
+	{
+		heap_ptr result = NULL;
+
+		TRACE_ENTRY();
+
+		if(!m_initialized) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_UNINITIALIZED);
+		}
+
+		if(!m_heap) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_UNINITIALIZED);
+		}
+
+		result = m_heap;
+
+		TRACE_EXIT("Return Value: 0x%p", result);
+		return result;
+	}
+
 	node_factory_ptr 
 	_luna::acquire_node_factory(void)
 	{
@@ -139,6 +184,27 @@ namespace LUNA_NS {
 		return result;
 	}
 
+	shape_factory_ptr 
+	_luna::acquire_shape_factory(void)
+	{
+		shape_factory_ptr result = NULL;
+
+		TRACE_ENTRY();
+
+		if(!m_initialized) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_UNINITIALIZED);
+		}
+
+		if(!m_shape_factory) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_UNINITIALIZED);
+		}
+
+		result = m_shape_factory;
+
+		TRACE_EXIT("Return Value: 0x%p", result);
+		return result;
+	}
+
 	token_factory_ptr 
 	_luna::acquire_token_factory(void)
 	{
@@ -189,10 +255,18 @@ namespace LUNA_NS {
 
 		if(m_initialized) {
 
+			if(m_heap) {
+				m_heap->destroy();
+			}
+
 			if(m_scope_factory) {
 				m_scope_factory->destroy();
 			}
 
+			if(m_shape_factory) {
+				m_shape_factory->destroy();
+			}
+
 			if(m_node_factory) {
 				m_node_factory->destroy();
 			}
@@ -205,43 +279,85 @@ namespace LUNA_NS {
 				m_uuid_factory->destroy();
 			}
 
+			if(m_atom_factory) {
+				m_atom_factory->destroy();
+			}
+
 			m_initialized = false;
 		}
 
 		TRACE_EXIT("Return Value: 0x%x", NULL);
 	}
 
+	heap_stats_t 
+	_luna::get_heap_stats(void)
+	{
+		heap_stats_t result;
+
+		TRACE_ENTRY();
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		result = acquire_heap()->get_stats();
+
+		TRACE_EXIT("Return Value: 0x%x", NULL);
+		return result;
+	}
+
 	void 
-	_luna::initialize(void)
+	_luna::initialize(
+		__in_opt uuid_reg_t registry,
+		__in_opt uuid_gen_t generator,
+		__in_opt uuid_ref_t reference,
+		__in_opt bool id_mapping
+		)
 	{
 		TRACE_ENTRY();
 		SERIALIZE_CALL_RECUR(m_lock);
 
 		destroy();
 
+		if(!m_atom_factory) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
+		}
+
+		m_atom_factory->initialize();
+
 		if(!m_uuid_factory) {
 			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
 		}
 
-		m_uuid_factory->initialize((std::rand() << 0x10) | std::rand());
+		m_uuid_factory->initialize((std::rand() << 0x10) | std::rand(), registry, generator, 
+			reference);
 
 		if(!m_token_factory) {
 			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
 		}
 
-		m_token_factory->initialize();
+		m_token_factory->initialize(id_mapping);
 
 		if(!m_node_factory) {
 			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
 		}
 
-		m_node_factory->initialize();
+		m_node_factory->initialize(id_mapping);
 
 		if(!m_scope_factory) {
 			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
 		}
 
-		m_scope_factory->initialize();
+		m_scope_factory->initialize(id_mapping);
+
+		if(!m_shape_factory) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
+		}
+
+		m_shape_factory->initialize();
+
+		if(!m_heap) {
+			THROW_LUNA_EXCEPTION(LUNA_EXCEPTION_FACTORY_ALLOC_FAILED);
+		}
+
+		m_heap->initialize();
 		m_initialized = true;
 
 		TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -274,6 +390,71 @@ namespace LUNA_NS {
 		return result;
 	}
 
+	void 
+	_luna::set_heap_callback(
+		__in_opt heap_collect_cb_t callback
+		)
+	{
+		TRACE_ENTRY();
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		acquire_heap()->set_callback(callback);
+
+		TRACE_EXIT("Return Value: 0x%x", NULL);
+	}
+
+	void 
+	_luna::set_heap_limit(
+		__in size_t limit
+		)
+	{
+		TRACE_ENTRY();
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		acquire_heap()->set_limit(limit);
+
+		TRACE_EXIT("Return Value: 0x%x", NULL);
+	}
+
+	void 
+	_luna::set_heap_overrun_callback(
+		__in_opt heap_overrun_cb_t callback
+		)
+	{
+		TRACE_ENTRY();
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		acquire_heap()->set_overrun_callback(callback);
+
+		TRACE_EXIT("Return Value: 0x%x", NULL);
+	}
+
+	void 
+	_luna::set_heap_pause_budget(
+		__in uint32_t pause_budget
+		)
+	{
+		TRACE_ENTRY();
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		acquire_heap()->set_pause_budget(pause_budget);
+
+		TRACE_EXIT("Return Value: 0x%x", NULL);
+	}
+
+	void 
+	_luna::set_heap_trigger_ratio(
+		__in double ratio
+		)
+	{
+		TRACE_ENTRY();
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		acquire_heap()->set_trigger_ratio(ratio);
+
+		TRACE_EXIT("Return Value: 0x%x", NULL);
+	}
+
 	std::string 
 	_luna::to_string(
 		__in_opt bool verbose
@@ -284,7 +465,16 @@ namespace LUNA_NS {
 		TRACE_ENTRY();
 		SERIALIZE_CALL_RECUR(m_lock);
 
-		result << "UUID Factory" << std::endl << "---" << std::endl;
+		result << "ATOM Factory" << std::endl << "---" << std::endl;
+
+		if(m_atom_factory) {
+			result << m_atom_factory->to_string(verbose);
+		} else {
+			result << "(NULL)";
+		}
+
+		result << std::endl << "---" << std::endl << "UUID Factory" 
+			<< std::endl << "---" << std::endl;
 
 		if(m_uuid_factory) {
 			result << m_uuid_factory->to_string(verbose);
@@ -319,6 +509,24 @@ namespace LUNA_NS {
 			result << "(NULL)";
 		}
 
+		result << std::endl << "---" << std::endl << "SHAPE Factory" 
+			<< std::endl << "---" << std::endl;
+
+		if(m_shape_factory) {
+			result << m_shape_factory->to_string(verbose);
+		} else {
+			result << "(NULL)";
+		}
+
+		result << std::endl << "---" << std::endl << "HEAP" 
+			<< std::endl << "---" << std::endl;
+
+		if(m_heap) {
+			result << m_heap->to_string(verbose);
+		} else {
+			result << "(NULL)";
+		}
+
 		result << std::endl << "---" << std::endl;
 
 		TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -40,12 +40,20 @@
 #endif // LUNA_COMP_NS
 
 #include "luna_uuid.h"
+#include "luna_handle.h"
+#include "luna_atom.h"
+#include "luna_image.h"
 #include "luna_node.h"
+#include "luna_shape.h"
 #include "luna_scope.h"
+#include "luna_heap.h"
 #include "luna_token.h"
+#include "luna_value.h"
+#include "luna_context.h"
 
 #include "luna_lexer.h"
 #include "luna_parser.h"
+#include "luna_resolver.h"
 
 #ifndef LUNA_RUNTIME_NS
 #define LUNA_RUNTIME_NS runtime_ns
@@ -70,22 +78,55 @@ namespace LUNA_NS {
 				__in_opt generic_cb_t dest = NULL
 				);
 
+			atom_factory_ptr acquire_atom_factory(void);
+
+			heap_ptr acquire_heap(void);
+
 			node_factory_ptr acquire_node_factory(void);
 
 			scope_factory_ptr acquire_scope_factory(void);
 
+			shape_factory_ptr acquire_shape_factory(void);
+
 			token_factory_ptr acquire_token_factory(void);
 
 			uuid_factory_ptr acquire_uuid_factory(void);
 
 			void destroy(void);
 
-			void initialize(void);
+			heap_stats_t get_heap_stats(void);
+
+			void initialize(
+				__in_opt uuid_reg_t registry = UUID_REGISTRY_SHARDED,
+				__in_opt uuid_gen_t generator = UUID_GENERATOR_RANDOM,
+				__in_opt uuid_ref_t reference = UUID_REFERENCE_INTRUSIVE,
+				__in_opt bool id_mapping = HANDLE_ID_MAPPING_DEFAULT
+				);
 
 			static bool is_globally_initialized(void);
 
 			bool is_initialized(void);
 
+			void set_heap_callback(
+				__in_opt heap_collect_cb_t callback = NULL
+				);
+
+			void set_heap_limit(
+				__in size_t limit
+				);
+
+			void set_heap_overrun_callback(
+				__in_opt heap_overrun_cb_t callback = NULL
+				);
+
+			void set_heap_pause_budget(
+				__in uint32_t pause_budget
+				);
+
+			void set_heap_trigger_ratio(
+				__in double ratio
+				);
+
 			std::string to_string(
 				__in_opt bool verbose = false
 				);
@@ -114,8 +155,12 @@ namespace LUNA_NS {
 				__in const _luna &other
 				);
 
+			atom_factory_ptr m_atom_factory;
+
 			static bool m_glob_initalized;
 
+			heap_ptr m_heap;
+
 			bool m_initialized;
 
 			static _luna *m_instance;
@@ -124,6 +169,8 @@ namespace LUNA_NS {
 
 			scope_factory_ptr m_scope_factory;
 
+			shape_factory_ptr m_shape_factory;
+
 			token_factory_ptr m_token_factory;
 
 			uuid_factory_ptr m_uuid_factory;
@@ -0,0 +1,373 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "luna.h"
+#include "luna_atom_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		_atom_factory *_atom_factory::m_instance = NULL;
+
+		void 
+		atom_factory_destroy(void)
+		{
+			TRACE_ENTRY();
+
+			if(atom_factory::m_instance) {
+				delete atom_factory::m_instance;
+				atom_factory::m_instance = NULL;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_atom_factory::_atom_factory(
+			__in_opt generic_cb_t dest
+			) :
+				m_hit_count(0),
+				m_initialized(false),
+				m_lookup_count(0),
+				m_text_byte_count(0)
+		{
+			TRACE_ENTRY();
+
+			if(dest) {
+				std::atexit(dest);
+			} else {
+				std::atexit(atom_factory_destroy);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_atom_factory::~_atom_factory(void)
+		{
+			TRACE_ENTRY();
+
+			destroy();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_atom_factory *
+		_atom_factory::acquire(
+			__in_opt generic_cb_t dest
+			)
+		{
+			atom_factory_ptr result;
+
+			TRACE_ENTRY();
+
+			if(!m_instance) {
+				
+				m_instance = new atom_factory(dest);
+				if(!m_instance) {
+					THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_ALLOC_FAILED);
+				}
+			}
+
+			result = m_instance;
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_atom_factory::clear(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_text_list.clear();
+			m_atom_map.clear();
+			m_hit_count = 0;
+			m_lookup_count = 0;
+			m_text_byte_count = 0;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_atom_factory::destroy(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized) {
+				clear();
+				m_initialized = false;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		atom_t 
+		_atom_factory::find(
+			__in const std::string &text
+			)
+		{
+			atom_t result = ATOM_INVALID;
+			std::unordered_map<std::string, atom_t>::iterator atom_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			atom_iter = m_atom_map.find(text);
+			if(atom_iter != m_atom_map.end()) {
+				result = atom_iter->second;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		atom_t 
+		_atom_factory::generate(
+			__in const std::string &text
+			)
+		{
+			atom_t result;
+			std::pair<std::unordered_map<std::string, atom_t>::iterator, bool> atom_pair;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(text.empty()) {
+				THROW_LUNA_ATOM_EXCEPTION_MESSAGE(LUNA_ATOM_EXCEPTION_INVALID_TEXT,
+					"\'%s\' (%lu)", text.c_str(), text.size());
+			}
+
+			++m_lookup_count;
+
+			atom_pair = m_atom_map.insert(std::pair<std::string, atom_t>(text, m_text_list.size()));
+			if(!atom_pair.second) {
+				++m_hit_count;
+			} else {
+
+				if(m_text_list.size() >= ATOM_INVALID) {
+					m_atom_map.erase(atom_pair.first);
+					THROW_LUNA_ATOM_EXCEPTION_MESSAGE(LUNA_ATOM_EXCEPTION_TABLE_FULL,
+						"%lu", m_text_list.size());
+				}
+
+				m_text_list.push_back(&atom_pair.first->first);
+				m_text_byte_count += text.size();
+			}
+
+			result = atom_pair.first->second;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		size_t 
+		_atom_factory::get_hit_count(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_hit_count;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		double 
+		_atom_factory::get_hit_rate(void)
+		{
+			double result = 0;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_lookup_count) {
+				result = m_hit_count / (double) m_lookup_count;
+			}
+
+			TRACE_EXIT("Return Value: %f", result);
+			return result;
+		}
+
+		size_t 
+		_atom_factory::get_lookup_count(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_lookup_count;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		const std::string &
+		_atom_factory::get_text(
+			__in atom_t atom
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(atom >= m_text_list.size()) {
+				THROW_LUNA_ATOM_EXCEPTION_MESSAGE(LUNA_ATOM_EXCEPTION_ATOM_NOT_FOUND,
+					"0x%x", atom);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return *m_text_list[atom];
+		}
+
+		bool 
+		_atom_factory::has_atom(
+			__in atom_t atom
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = (atom < m_text_list.size());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_atom_factory::has_text(
+			__in const std::string &text
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (find(text) != ATOM_INVALID);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_atom_factory::initialize(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			destroy();
+			m_initialized = true;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		bool 
+		_atom_factory::is_initialized(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_initialized;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		size_t 
+		_atom_factory::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_text_list.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_atom_factory::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+			std::vector<const std::string *>::iterator text_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_ATOM_EXCEPTION(LUNA_ATOM_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(verbose) {
+				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
+			}
+
+			result << "Entries: " << m_text_list.size() << ", Bytes: " << m_text_byte_count
+				<< ", Lookups: " << m_lookup_count << ", Hits: " << m_hit_count 
+				<< " (" << std::fixed << std::setprecision(1) << (get_hit_rate() * 100.0) << "%)";
+
+			if(verbose) {
+
+				for(text_iter = m_text_list.begin(); text_iter != m_text_list.end(); ++text_iter) {
+					result << std::endl << "{" << (text_iter - m_text_list.begin()) << "} \'" 
+						<< **text_iter << "\'";
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+	}
+}
@@ -0,0 +1,122 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_ATOM_H_
+#define LUNA_ATOM_H_
+
+#include <unordered_map>
+#include <vector>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		typedef uint32_t atom_t;
+
+		#define ATOM_INVALID ((atom_t) INVALID)
+
+		typedef class _atom_factory {
+
+			public:
+
+				static _atom_factory *acquire(
+					__in_opt generic_cb_t dest = NULL
+					);
+
+				void clear(void);
+
+				void destroy(void);
+
+				atom_t find(
+					__in const std::string &text
+					);
+
+				atom_t generate(
+					__in const std::string &text
+					);
+
+				size_t get_hit_count(void);
+
+				double get_hit_rate(void);
+
+				size_t get_lookup_count(void);
+
+				const std::string &get_text(
+					__in atom_t atom
+					);
+
+				bool has_atom(
+					__in atom_t atom
+					);
+
+				bool has_text(
+					__in const std::string &text
+					);
+
+				void initialize(void);
+
+				bool is_initialized(void);
+
+				size_t size(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				friend void atom_factory_destroy(void);
+
+				_atom_factory(
+					__in_opt generic_cb_t dest = NULL
+					);
+
+				_atom_factory(
+					__in const _atom_factory &other
+					);
+
+				~_atom_factory(void);
+
+				_atom_factory &operator=(
+					__in const _atom_factory &other
+					);
+
+				std::unordered_map<std::string, atom_t> m_atom_map;
+
+				size_t m_hit_count;
+
+				bool m_initialized;
+
+				static _atom_factory *m_instance;
+
+				size_t m_lookup_count;
+
+				size_t m_text_byte_count;
+
+				std::vector<const std::string *> m_text_list;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} atom_factory, *atom_factory_ptr;
+	}
+}
+
+#endif // LUNA_ATOM_H_
@@ -0,0 +1,57 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_ATOM_TYPE_H_
+#define LUNA_ATOM_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_ATOM_EXCEPTION_ALLOC_FAILED = 0,
+			LUNA_ATOM_EXCEPTION_ATOM_NOT_FOUND,
+			LUNA_ATOM_EXCEPTION_INVALID_TEXT,
+			LUNA_ATOM_EXCEPTION_TABLE_FULL,
+			LUNA_ATOM_EXCEPTION_UNINITIALIZED,
+		};
+
+		static const std::string LUNA_ATOM_EXCEPTION_STR[] = {
+			"Atom factory allocation failed",
+			"Atom was not found",
+			"Invalid atom text",
+			"Atom table is full",
+			"Atom factory uninitialized",
+			};
+
+		#define LUNA_ATOM_EXCEPTION_MAX LUNA_ATOM_EXCEPTION_UNINITIALIZED
+
+		#define LUNA_ATOM_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_ATOM_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_ATOM_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_ATOM_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_ATOM_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_ATOM_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_ATOM_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _atom_factory;
+		typedef _atom_factory atom_factory, *atom_factory_ptr;
+	}
+}
+
+#endif // LUNA_ATOM_TYPE_H_
@@ -0,0 +1,139 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "luna.h"
+#include "luna_context_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		_context::_context(
+			__in_opt bool id_mapping
+			) :
+				m_id_mapping(id_mapping),
+				m_scope_factory(NULL)
+		{
+			TRACE_ENTRY();
+
+			m_scope_factory = new scope_factory;
+			if(!m_scope_factory) {
+				THROW_LUNA_CONTEXT_EXCEPTION(LUNA_CONTEXT_EXCEPTION_ALLOC_FAILED);
+			}
+
+			m_scope_factory->initialize(m_id_mapping);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_context::_context(
+			__in const _context &other
+			) :
+				m_id_mapping(other.m_id_mapping),
+				m_node_arena(other.m_node_arena),
+				m_scope_factory(NULL)
+		{
+			TRACE_ENTRY();
+
+			m_scope_factory = new scope_factory;
+			if(!m_scope_factory) {
+				THROW_LUNA_CONTEXT_EXCEPTION(LUNA_CONTEXT_EXCEPTION_ALLOC_FAILED);
+			}
+
+			m_scope_factory->initialize(m_id_mapping);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_context::~_context(void)
+		{
+			TRACE_ENTRY();
+
+			if(m_scope_factory) {
+				delete m_scope_factory;
+				m_scope_factory = NULL;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_context::clear(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_scope_factory->clear();
+			m_node_arena.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		node_arena_ptr 
+		_context::get_node_arena(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", &m_node_arena);
+			return &m_node_arena;
+		}
+
+		scope_factory_ptr 
+		_context::get_scope_factory(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", m_scope_factory);
+			return m_scope_factory;
+		}
+
+		bool 
+		_context::is_id_mapped(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_id_mapping;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		std::string 
+		_context::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "NODE Arena" << std::endl << "---" << std::endl 
+				<< m_node_arena.to_string(verbose) << std::endl << "---" << std::endl 
+				<< "SCOPE Factory" << std::endl << "---" << std::endl 
+				<< m_scope_factory->to_string(verbose) << std::endl << "---" << std::endl;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+	}
+}
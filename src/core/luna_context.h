@@ -0,0 +1,77 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_CONTEXT_H_
+#define LUNA_CONTEXT_H_
+
+#include <memory>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		typedef class _context {
+
+			public:
+
+				_context(
+					__in_opt bool id_mapping = HANDLE_ID_MAPPING_DEFAULT
+					);
+
+				_context(
+					__in const _context &other
+					);
+
+				virtual ~_context(void);
+
+				void clear(void);
+
+				node_arena_ptr get_node_arena(void);
+
+				scope_factory_ptr get_scope_factory(void);
+
+				bool is_id_mapped(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				_context &operator=(
+					__in const _context &other
+					);
+
+				bool m_id_mapping;
+
+				node_arena m_node_arena;
+
+				scope_factory_ptr m_scope_factory;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} context, *context_ptr;
+
+		typedef std::shared_ptr<context> context_shared_t;
+	}
+}
+
+#endif // LUNA_CONTEXT_H_
@@ -0,0 +1,49 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_CONTEXT_TYPE_H_
+#define LUNA_CONTEXT_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_CONTEXT_EXCEPTION_ALLOC_FAILED = 0,
+		};
+
+		static const std::string LUNA_CONTEXT_EXCEPTION_STR[] = {
+			"Context factory allocation failed",
+			};
+
+		#define LUNA_CONTEXT_EXCEPTION_MAX LUNA_CONTEXT_EXCEPTION_ALLOC_FAILED
+
+		#define LUNA_CONTEXT_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_CONTEXT_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_CONTEXT_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_CONTEXT_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_CONTEXT_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_CONTEXT_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_CONTEXT_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _context;
+		typedef _context context, *context_ptr;
+	}
+}
+
+#endif // LUNA_CONTEXT_TYPE_H_
@@ -0,0 +1,235 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "luna.h"
+#include "luna_handle_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		_handle_table::_handle_table(void) :
+			m_size(0)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_handle_table::_handle_table(
+			__in const _handle_table &other
+			) :
+				m_free_list(other.m_free_list),
+				m_generation(other.m_generation),
+				m_size(other.m_size)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_handle_table::~_handle_table(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_handle_table &
+		_handle_table::operator=(
+			__in const _handle_table &other
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(this != &other) {
+				m_free_list = other.m_free_list;
+				m_generation = other.m_generation;
+				m_size = other.m_size;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", this);
+			return *this;
+		}
+
+		handle_t 
+		_handle_table::allocate(void)
+		{
+			uint32_t slot;
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_free_list.empty()) {
+				slot = m_free_list.back();
+				m_free_list.pop_back();
+			} else {
+
+				if(m_generation.size() >= HANDLE_SLOT_MAX) {
+					THROW_LUNA_HANDLE_EXCEPTION_MESSAGE(LUNA_HANDLE_EXCEPTION_TABLE_FULL,
+						"%lu", m_generation.size());
+				}
+
+				slot = (uint32_t) m_generation.size();
+				m_generation.push_back(0);
+			}
+
+			result = MAKE_HANDLE(slot, ++m_generation.at(slot));
+			++m_size;
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		size_t 
+		_handle_table::capacity(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_generation.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_handle_table::clear(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_free_list.clear();
+			m_generation.clear();
+			m_size = 0;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		uint32_t 
+		_handle_table::get_slot(
+			__in handle_t handle
+			)
+		{
+			uint32_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = HANDLE_SLOT(handle);
+			if((result >= m_generation.size())
+					|| (m_generation[result] != HANDLE_GENERATION(handle))
+					|| !(m_generation[result] & 1)) {
+				THROW_LUNA_HANDLE_EXCEPTION_MESSAGE(LUNA_HANDLE_EXCEPTION_INVALID_HANDLE,
+					"%s", handle_as_string(handle).c_str());
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_handle_table::handle_as_string(
+			__in handle_t handle
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+
+			result << "{" << HANDLE_SLOT(handle) << ":" << HANDLE_GENERATION(handle) << "}";
+
+			TRACE_EXIT("Return Value: %s", result.str().c_str());
+			return result.str();
+		}
+
+		bool 
+		_handle_table::is_valid(
+			__in handle_t handle
+			)
+		{
+			bool result;
+			uint32_t slot;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			slot = HANDLE_SLOT(handle);
+			result = ((slot < m_generation.size())
+					&& (m_generation[slot] == HANDLE_GENERATION(handle))
+					&& (m_generation[slot] & 1));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_handle_table::release(
+			__in handle_t handle
+			)
+		{
+			uint32_t slot;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			slot = get_slot(handle);
+			++m_generation.at(slot);
+			m_free_list.push_back(slot);
+			--m_size;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_handle_table::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_size;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_handle_table::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Handles: " << m_size << "/" << m_generation.size();
+
+			if(verbose) {
+				result << ", Free: " << m_free_list.size();
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+	}
+}
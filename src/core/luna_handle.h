@@ -0,0 +1,105 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_HANDLE_H_
+#define LUNA_HANDLE_H_
+
+#include <vector>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		typedef uint64_t handle_t, *handle_ptr_t;
+
+		#define HANDLE_INVALID ((handle_t) INVALID)
+		#define HANDLE_SLOT_MAX ((uint32_t) INVALID)
+
+		#define HANDLE_GENERATION(_HANDLE_) ((uint32_t) ((_HANDLE_) >> 0x20))
+		#define HANDLE_SLOT(_HANDLE_) ((uint32_t) (_HANDLE_))
+		#define MAKE_HANDLE(_SLOT_, _GENERATION_)\
+			((((handle_t) (uint32_t) (_GENERATION_)) << 0x20) | (uint32_t) (_SLOT_))
+
+#ifdef _DEBUG
+		#define HANDLE_ID_MAPPING_DEFAULT true
+#else
+		#define HANDLE_ID_MAPPING_DEFAULT false
+#endif // _DEBUG
+
+		typedef class _handle_table {
+
+			public:
+
+				_handle_table(void);
+
+				_handle_table(
+					__in const _handle_table &other
+					);
+
+				virtual ~_handle_table(void);
+
+				_handle_table &operator=(
+					__in const _handle_table &other
+					);
+
+				handle_t allocate(void);
+
+				size_t capacity(void);
+
+				void clear(void);
+
+				uint32_t get_slot(
+					__in handle_t handle
+					);
+
+				static std::string handle_as_string(
+					__in handle_t handle
+					);
+
+				bool is_valid(
+					__in handle_t handle
+					);
+
+				void release(
+					__in handle_t handle
+					);
+
+				size_t size(void);
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				std::vector<uint32_t> m_free_list;
+
+				std::vector<uint32_t> m_generation;
+
+				size_t m_size;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} handle_table, *handle_table_ptr;
+	}
+}
+
+#endif // LUNA_HANDLE_H_
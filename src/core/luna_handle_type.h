@@ -0,0 +1,51 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_HANDLE_TYPE_H_
+#define LUNA_HANDLE_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_HANDLE_EXCEPTION_INVALID_HANDLE = 0,
+			LUNA_HANDLE_EXCEPTION_TABLE_FULL,
+		};
+
+		static const std::string LUNA_HANDLE_EXCEPTION_STR[] = {
+			"Handle is invalid or stale",
+			"Handle table is full",
+			};
+
+		#define LUNA_HANDLE_EXCEPTION_MAX LUNA_HANDLE_EXCEPTION_TABLE_FULL
+
+		#define LUNA_HANDLE_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_HANDLE_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_HANDLE_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_HANDLE_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_HANDLE_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_HANDLE_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_HANDLE_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _handle_table;
+		typedef _handle_table handle_table, *handle_table_ptr;
+	}
+}
+
+#endif // LUNA_HANDLE_TYPE_H_
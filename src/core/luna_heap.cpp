@@ -0,0 +1,1243 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "luna.h"
+#include "luna_heap_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		_heap *_heap::m_instance = NULL;
+
+		std::atomic<bool> _heap::m_marking(false);
+
+		void 
+		heap_destroy(void)
+		{
+			TRACE_ENTRY();
+
+			if(heap::m_instance) {
+				delete heap::m_instance;
+				heap::m_instance = NULL;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_heap::_heap(
+			__in_opt generic_cb_t dest
+			) :
+				m_bytes(0),
+				m_callback(NULL),
+				m_collection_count(0),
+				m_cycle(),
+				m_initialized(false),
+				m_limit(HEAP_LIMIT_NONE),
+				m_overrun_callback(NULL),
+				m_pause_budget(HEAP_PAUSE_BUDGET_DEFAULT),
+				m_phase(HEAP_PHASE_IDLE),
+				m_root_element(0),
+				m_root_position(0),
+				m_root_slot(0),
+				m_root_symbol_position(0),
+				m_root_trace(NULL),
+				m_stats(),
+				m_sweep_position(0),
+				m_threshold(HEAP_THRESHOLD_MIN),
+				m_trace_position(0),
+				m_trace_symbol(NULL),
+				m_trigger_ratio(HEAP_TRIGGER_RATIO_DEFAULT),
+				m_unit_max(0)
+		{
+			TRACE_ENTRY();
+
+			if(dest) {
+				std::atexit(dest);
+			} else {
+				std::atexit(heap_destroy);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_heap::~_heap(void)
+		{
+			TRACE_ENTRY();
+
+			destroy();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_heap *
+		_heap::acquire(
+			__in_opt generic_cb_t dest
+			)
+		{
+			heap_ptr result;
+
+			TRACE_ENTRY();
+
+			if(!m_instance) {
+
+				m_instance = new heap(dest);
+				if(!m_instance) {
+					THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_ALLOC_FAILED);
+				}
+			}
+
+			result = m_instance;
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_heap::add_root(
+			__in scope_ptr root
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!root) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_INVALID_ROOT);
+			}
+
+			++m_root_scope_map[root];
+
+			if(m_phase == HEAP_PHASE_MARK) {
+				push_root(root);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::add_root(
+			__in symbol_ptr root
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!root) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_INVALID_ROOT);
+			}
+
+			++m_root_symbol_map[root];
+
+			if(m_phase == HEAP_PHASE_MARK) {
+				m_root_symbol_list.push_back(root);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		bool 
+		_heap::advance(
+			__in uint32_t pause_budget
+			)
+		{
+			bool result = false;
+			double elapsed = 0, previous, unit_max = 0;
+			heap_object_ptr_t object;
+			heap_clock_t::time_point begin = heap_clock_t::now();
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_phase == HEAP_PHASE_IDLE) {
+				m_gray_list.clear();
+				m_trace_symbol = NULL;
+				m_phase = HEAP_PHASE_MARK;
+				m_marking = true;
+				collect_roots();
+			}
+
+			while(m_phase != HEAP_PHASE_IDLE) {
+
+				if(m_phase == HEAP_PHASE_MARK) {
+
+					if(m_trace_symbol || !m_gray_list.empty()) {
+
+						if(!m_trace_symbol) {
+							m_trace_symbol = m_gray_list.back();
+							m_gray_list.pop_back();
+							m_trace_position = 0;
+						}
+
+						if(trace(m_trace_symbol, m_trace_position, HEAP_TRACE_CHUNK)) {
+							m_trace_symbol = NULL;
+						}
+					} else if(mark_root()) {
+						m_phase = HEAP_PHASE_SWEEP;
+						m_marking = false;
+						m_root_list.clear();
+						m_root_symbol_list.clear();
+						m_root_trace = NULL;
+						m_sweep_position = 0;
+					}
+				} else if(m_sweep_position < m_object_list.size()) {
+
+					object = &m_object_list[m_sweep_position];
+					if(object->marked) {
+
+						if(object->cycle == m_collection_count) {
+							++m_cycle.objects_promoted;
+						}
+
+						object->marked = false;
+						++m_sweep_position;
+					} else {
+						release(m_sweep_position);
+					}
+				} else {
+					m_phase = HEAP_PHASE_IDLE;
+					m_threshold = std::max((size_t) HEAP_THRESHOLD_MIN, 
+						(size_t) (m_bytes * m_trigger_ratio));
+					++m_collection_count;
+					result = true;
+				}
+
+				if(pause_budget) {
+					previous = elapsed;
+					elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+						heap_clock_t::now() - begin).count();
+					unit_max = std::max(unit_max, elapsed - previous);
+
+					if((elapsed + std::max(unit_max, m_unit_max)) >= pause_budget) {
+						break;
+					}
+				}
+			}
+
+			elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+				heap_clock_t::now() - begin).count();
+			m_cycle.duration += elapsed;
+			m_unit_max = unit_max;
+			m_cycle.pause_max = std::max(m_cycle.pause_max, elapsed);
+			++m_cycle.steps;
+
+			if(pause_budget && (elapsed > pause_budget)) {
+				++m_cycle.steps_over_budget;
+
+				if(m_overrun_callback) {
+					m_overrun_callback(elapsed, pause_budget);
+				}
+			}
+
+			if(result) {
+				m_cycle.collections = m_collection_count;
+				m_cycle.bytes_live = m_bytes;
+				m_cycle.objects_live = m_object_list.size();
+				m_stats = m_cycle;
+				m_cycle = heap_stats_t();
+
+				if(m_callback) {
+					m_callback(m_stats);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_heap::allocate(
+			__in scope_sym_t type
+			)
+		{
+			heap_object_t object;
+			symbol_ptr result = NULL;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if((m_phase != HEAP_PHASE_IDLE) || (m_bytes >= m_threshold)) {
+				advance(m_pause_budget);
+			}
+
+			if((m_limit != HEAP_LIMIT_NONE) && (m_bytes >= m_limit)) {
+
+				if(m_phase != HEAP_PHASE_IDLE) {
+					advance(0);
+				}
+
+				advance(0);
+
+				if(m_bytes >= m_limit) {
+					THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_LIMIT_EXCEEDED,
+						"%lu/%lu", m_bytes, m_limit);
+				}
+			}
+
+			switch(type) {
+				case SCOPE_SYMBOL_ARRAY:
+					result = new symbol_array(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_BOOLEAN:
+					result = new symbol_boolean(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_FLOAT:
+					result = new symbol_float(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_FUNCTION:
+					result = new symbol_function(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_IDENTIFIER:
+					result = new symbol_identifier(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_INTEGER:
+					result = new symbol_integer(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_LITERAL_STRING:
+					result = new symbol_literal_string(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_NULL:
+					result = new symbol_null(NULL, HEAP_OBJECT_KEY);
+					break;
+				case SCOPE_SYMBOL_STRUCTURE:
+					result = new symbol_structure(NULL, HEAP_OBJECT_KEY);
+					break;
+				default:
+					THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_INVALID_TYPE,
+						"%lu", type);
+			}
+
+			if(!result) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_ALLOC_FAILED);
+			}
+
+			object.bytes = measure(result);
+			object.cycle = (m_collection_count + ((m_phase != HEAP_PHASE_IDLE) ? 1 : 0));
+			object.marked = (m_phase != HEAP_PHASE_IDLE);
+			object.sym = result;
+			m_bytes += object.bytes;
+			m_id_map.insert(std::pair<uuid, symbol_ptr>(result->get_id(), result));
+			m_object_map.insert(std::pair<symbol_ptr, size_t>(result, m_object_list.size()));
+			m_object_list.push_back(object);
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_heap::clear(void)
+		{
+			std::vector<heap_object_t>::iterator object_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			for(object_iter = m_object_list.begin(); object_iter != m_object_list.end(); ++object_iter) {
+				m_root_symbol_map.erase(object_iter->sym);
+				delete object_iter->sym;
+			}
+
+			m_bytes = 0;
+			m_collection_count = 0;
+			m_cycle = heap_stats_t();
+			m_gray_list.clear();
+			m_id_map.clear();
+			m_object_map.clear();
+			m_marking = false;
+			m_object_list.clear();
+			m_phase = HEAP_PHASE_IDLE;
+			m_root_element = 0;
+			m_root_list.clear();
+			m_root_position = 0;
+			m_root_slot = 0;
+			m_root_symbol_list.clear();
+			m_root_symbol_position = 0;
+			m_root_trace = NULL;
+			m_stats = heap_stats_t();
+			m_sweep_position = 0;
+			m_threshold = HEAP_THRESHOLD_MIN;
+			m_trace_position = 0;
+			m_trace_symbol = NULL;
+			m_unit_max = 0;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::collect(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(m_phase != HEAP_PHASE_IDLE) {
+				advance(0);
+			}
+
+			advance(0);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::collect_roots(void)
+		{
+			std::unordered_map<scope_ptr, size_t>::iterator scope_iter;
+			std::unordered_map<symbol_ptr, size_t>::iterator symbol_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_root_list.clear();
+			m_root_symbol_list.clear();
+
+			for(scope_iter = m_root_scope_map.begin(); scope_iter != m_root_scope_map.end(); 
+					++scope_iter) {
+				push_root(scope_iter->first);
+			}
+
+			for(symbol_iter = m_root_symbol_map.begin(); symbol_iter != m_root_symbol_map.end(); 
+					++symbol_iter) {
+				m_root_symbol_list.push_back(symbol_iter->first);
+			}
+
+			m_root_element = 0;
+			m_root_position = 0;
+			m_root_slot = 0;
+			m_root_symbol_position = 0;
+			m_root_trace = NULL;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::destroy(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized) {
+				clear();
+				m_root_scope_map.clear();
+				m_root_symbol_map.clear();
+				m_callback = NULL;
+				m_limit = HEAP_LIMIT_NONE;
+				m_overrun_callback = NULL;
+				m_pause_budget = HEAP_PAUSE_BUDGET_DEFAULT;
+				m_trigger_ratio = HEAP_TRIGGER_RATIO_DEFAULT;
+				m_initialized = false;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_heap::get_bytes(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: %lu", m_bytes);
+			return m_bytes;
+		}
+
+		size_t 
+		_heap::get_collection_count(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: %lu", m_collection_count);
+			return m_collection_count;
+		}
+
+		size_t 
+		_heap::get_limit(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: %lu", m_limit);
+			return m_limit;
+		}
+
+		symbol_ptr 
+		_heap::get_object(
+			__in const uuid &id
+			)
+		{
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			id_iter = m_id_map.find(id);
+			if(id_iter == m_id_map.end()) {
+				THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_INVALID_OBJECT,
+					"%s", id.to_string().c_str());
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", id_iter->second);
+			return id_iter->second;
+		}
+
+		uint32_t 
+		_heap::get_pause_budget(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: %lu", m_pause_budget);
+			return m_pause_budget;
+		}
+
+		heap_phase_t 
+		_heap::get_phase(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", m_phase);
+			return m_phase;
+		}
+
+		heap_stats_t 
+		_heap::get_stats(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return m_stats;
+		}
+
+		double 
+		_heap::get_trigger_ratio(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: %f", m_trigger_ratio);
+			return m_trigger_ratio;
+		}
+
+		bool 
+		_heap::has_object(
+			__in symbol_ptr sym
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = (m_object_map.find(sym) != m_object_map.end());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_heap::initialize(
+			__in_opt uint32_t pause_budget
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			destroy();
+			m_initialized = true;
+			clear();
+			set_pause_budget(pause_budget);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		bool 
+		_heap::is_initialized(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_initialized;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_heap::is_marking(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = m_marking;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_heap::mark_root(void)
+		{
+			bool result = false;
+			symbol_ptr sym = NULL;
+			heap_root_ptr_t root;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_root_position < m_root_list.size()) {
+
+				root = &m_root_list[m_root_position];
+				if(root->scop && (m_root_slot < root->scop->get_table_size())) {
+
+					sym = root->scop->get_table_slot(m_root_slot);
+					if(!sym) {
+						++m_root_slot;
+					}
+				} else {
+					++m_root_position;
+					m_root_slot = 0;
+				}
+			} else if(m_root_symbol_position < m_root_symbol_list.size()) {
+
+				sym = m_root_symbol_list[m_root_symbol_position];
+				if(m_root_symbol_map.find(sym) == m_root_symbol_map.end()) {
+					sym = NULL;
+					++m_root_symbol_position;
+				}
+			} else {
+				result = true;
+			}
+
+			if(sym) {
+
+				if(m_object_map.find(sym) != m_object_map.end()) {
+					shade(sym);
+					sym = NULL;
+				} else {
+
+					if(sym != m_root_trace) {
+						m_root_element = 0;
+						m_root_trace = sym;
+					}
+
+					if(trace(sym, m_root_element, HEAP_TRACE_CHUNK)) {
+						sym = NULL;
+						m_root_trace = NULL;
+					}
+				}
+
+				if(!sym) {
+
+					if(m_root_position < m_root_list.size()) {
+						++m_root_slot;
+					} else {
+						++m_root_symbol_position;
+					}
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		size_t 
+		_heap::measure(
+			__in symbol_ptr sym
+			)
+		{
+			size_t result = 0;
+
+			TRACE_ENTRY();
+
+			switch(sym->get_type()) {
+				case SCOPE_SYMBOL_ARRAY:
+					result = sizeof(symbol_array) + ((symbol_array_ptr) sym)->get_store_size();
+					break;
+				case SCOPE_SYMBOL_BOOLEAN:
+					result = sizeof(symbol_boolean);
+					break;
+				case SCOPE_SYMBOL_FLOAT:
+					result = sizeof(symbol_float);
+					break;
+				case SCOPE_SYMBOL_FUNCTION:
+					result = sizeof(symbol_function);
+					break;
+				case SCOPE_SYMBOL_IDENTIFIER:
+					result = sizeof(symbol_identifier) 
+						+ ((symbol_identifier_ptr) sym)->get_value().capacity();
+					break;
+				case SCOPE_SYMBOL_INTEGER:
+					result = sizeof(symbol_integer);
+					break;
+				case SCOPE_SYMBOL_LITERAL_STRING:
+					result = sizeof(symbol_literal_string) 
+						+ ((symbol_literal_string_ptr) sym)->get_value().capacity();
+					break;
+				case SCOPE_SYMBOL_NULL:
+					result = sizeof(symbol_null);
+					break;
+				case SCOPE_SYMBOL_STRUCTURE:
+					result = sizeof(symbol_structure) 
+						+ (((symbol_structure_ptr) sym)->size() * sizeof(uuid));
+					break;
+				default:
+					THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_INVALID_TYPE,
+						"%lu", sym->get_type());
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_heap::push_root(
+			__in scope_ptr root,
+			__in_opt const scope_shared_t &base
+			)
+		{
+			heap_root_t entry;
+			std::vector<heap_root_t>::iterator root_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			for(root_iter = m_root_list.begin(); root_iter != m_root_list.end(); ++root_iter) {
+
+				if(root_iter->scop == root) {
+					break;
+				}
+			}
+
+			if(root_iter == m_root_list.end()) {
+				entry.base = base;
+				entry.scop = root;
+				m_root_list.push_back(entry);
+
+				entry.base = root->get_base();
+				if(entry.base) {
+					push_root(entry.base.get(), entry.base);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::release(
+			__in size_t index
+			)
+		{
+			heap_object_t object;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(index >= m_object_list.size()) {
+				THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_INVALID_OBJECT,
+					"%lu", index);
+			}
+
+			object = m_object_list[index];
+			m_bytes -= std::min(m_bytes, object.bytes);
+			m_cycle.bytes_reclaimed += object.bytes;
+			++m_cycle.objects_reclaimed;
+			m_id_map.erase(object.sym->get_id());
+			m_object_map.erase(object.sym);
+
+			if(index != (m_object_list.size() - 1)) {
+				m_object_list[index] = m_object_list.back();
+				m_object_map[m_object_list[index].sym] = index;
+			}
+
+			m_object_list.pop_back();
+			delete object.sym;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::remove_root(
+			__in scope_ptr root
+			)
+		{
+			std::vector<heap_root_t>::iterator list_iter;
+			std::unordered_map<scope_ptr, size_t>::iterator root_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			root_iter = m_root_scope_map.find(root);
+			if((root_iter != m_root_scope_map.end()) && !--root_iter->second) {
+				m_root_scope_map.erase(root_iter);
+
+				for(list_iter = m_root_list.begin(); list_iter != m_root_list.end(); ++list_iter) {
+
+					if(!list_iter->base && (list_iter->scop == root)) {
+						list_iter->scop = NULL;
+					}
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::remove_root(
+			__in symbol_ptr root
+			)
+		{
+			std::unordered_map<symbol_ptr, size_t>::iterator root_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			root_iter = m_root_symbol_map.find(root);
+			if((root_iter != m_root_symbol_map.end()) && !--root_iter->second) {
+				m_root_symbol_map.erase(root_iter);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::root_barrier(
+			__in const scope_shared_t &base
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized && (m_phase == HEAP_PHASE_MARK) && base) {
+				push_root(base.get(), base);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::root_barrier(
+			__in symbol_ptr sym
+			)
+		{
+			size_t position = 0;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized && (m_phase == HEAP_PHASE_MARK) && sym) {
+
+				if(m_object_map.find(sym) != m_object_map.end()) {
+					shade(sym);
+				} else {
+					trace(sym, position);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::scan_barrier(
+			__in symbol_ptr sym
+			)
+		{
+			size_t position = 0;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized && (m_phase == HEAP_PHASE_MARK) && sym 
+					&& ((sym == m_trace_symbol) || (sym == m_root_trace))) {
+				trace(sym, position);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::set_callback(
+			__in_opt heap_collect_cb_t callback
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_callback = callback;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::set_limit(
+			__in size_t limit
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_limit = limit;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::set_overrun_callback(
+			__in_opt heap_overrun_cb_t callback
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_overrun_callback = callback;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::set_pause_budget(
+			__in uint32_t pause_budget
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!pause_budget) {
+				THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_INVALID_BUDGET,
+					"%lu", pause_budget);
+			}
+
+			m_pause_budget = pause_budget;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::set_trigger_ratio(
+			__in double ratio
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!(ratio >= HEAP_TRIGGER_RATIO_MIN)) {
+				THROW_LUNA_HEAP_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_INVALID_RATIO,
+					"%f", ratio);
+			}
+
+			m_trigger_ratio = ratio;
+			m_threshold = std::max((size_t) HEAP_THRESHOLD_MIN, (size_t) (m_bytes * m_trigger_ratio));
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::shade(
+			__in symbol_ptr sym
+			)
+		{
+			size_t bytes;
+			heap_object_ptr_t object;
+			std::unordered_map<symbol_ptr, size_t>::iterator object_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			object_iter = m_object_map.find(sym);
+			if(object_iter != m_object_map.end()) {
+
+				object = &m_object_list[object_iter->second];
+				if(!object->marked) {
+					bytes = measure(sym);
+					m_bytes = (m_bytes - std::min(m_bytes, object->bytes)) + bytes;
+					object->bytes = bytes;
+					object->marked = true;
+					m_gray_list.push_back(sym);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_heap::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_object_list.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		bool 
+		_heap::step(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = advance(m_pause_budget);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		std::string 
+		_heap::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+			std::vector<heap_object_t>::iterator object_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_HEAP_EXCEPTION(LUNA_HEAP_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(verbose) {
+				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
+			}
+
+			result << "Objects: " << m_object_list.size() << ", Bytes: " << m_bytes 
+				<< ", Phase: " << HEAP_PHASE_STRING(m_phase) << ", Collections: " 
+				<< m_collection_count << ", Budget: " << m_pause_budget << " us, Ratio: " 
+				<< m_trigger_ratio << ", Limit: ";
+
+			if(m_limit != HEAP_LIMIT_NONE) {
+				result << m_limit;
+			} else {
+				result << "none";
+			}
+
+			if(verbose) {
+
+				for(object_iter = m_object_list.begin(); object_iter != m_object_list.end(); 
+						++object_iter) {
+					result << std::endl << "{" << (object_iter - m_object_list.begin()) << "} " 
+						<< (object_iter->marked ? "(marked) " : "") << object_iter->bytes 
+						<< " bytes, " << scope::symbol_as_string(object_iter->sym, verbose);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		bool 
+		_heap::trace(
+			__in symbol_ptr sym,
+			__inout size_t &position,
+			__in_opt size_t count
+			)
+		{
+			shape_ptr layout;
+			size_t end, length;
+			symbol_array_ptr arr;
+			symbol_structure_ptr structure;
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			switch(sym->get_type()) {
+				case SCOPE_SYMBOL_ARRAY:
+
+					arr = (symbol_array_ptr) sym;
+					length = (arr->get_store() == SYMBOL_ARRAY_STORE_BOXED) ? arr->size() : 0;
+					position = std::min(position, length);
+					end = ((length - position) > count) ? (position + count) : length;
+
+					for(; position < end; ++position) {
+
+						if(arr->is_reference(position)) {
+
+							id_iter = m_id_map.find(arr->get_value(position));
+							if(id_iter != m_id_map.end()) {
+								shade(id_iter->second);
+							}
+						}
+					}
+					break;
+				case SCOPE_SYMBOL_STRUCTURE:
+
+					structure = (symbol_structure_ptr) sym;
+					layout = structure->get_shape();
+					length = structure->size();
+					position = std::min(position, length);
+					end = ((length - position) > count) ? (position + count) : length;
+
+					for(; position < end; ++position) {
+
+						id_iter = m_id_map.find(structure->get_value(layout->get_field(position)));
+						if(id_iter != m_id_map.end()) {
+							shade(id_iter->second);
+						}
+					}
+					break;
+				default:
+					length = 0;
+					position = 0;
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", position >= length);
+			return (position >= length);
+		}
+
+		void 
+		_heap::write_barrier(
+			__in const uuid &target
+			)
+		{
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized && (m_phase == HEAP_PHASE_MARK)) {
+
+				id_iter = m_id_map.find(target);
+				if(id_iter != m_id_map.end()) {
+					shade(id_iter->second);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_heap::write_barrier(
+			__in symbol_ptr target
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized && (m_phase == HEAP_PHASE_MARK)) {
+				shade(target);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+	}
+}
@@ -0,0 +1,324 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LUNA_HEAP_H_
+#define LUNA_HEAP_H_
+
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		typedef enum {
+			HEAP_PHASE_IDLE = 0,
+			HEAP_PHASE_MARK,
+			HEAP_PHASE_SWEEP,
+		} heap_phase_t;
+
+		#define HEAP_PHASE_MAX HEAP_PHASE_SWEEP
+
+		static const std::string HEAP_PHASE_STR[] = {
+			"IDLE", "MARK", "SWEEP",
+			};
+
+		#define HEAP_PHASE_STRING(_TYPE_)\
+			((_TYPE_) > HEAP_PHASE_MAX ? UNKNOWN : HEAP_PHASE_STR[_TYPE_].c_str())
+
+		#define HEAP_LIMIT_NONE 0
+		#define HEAP_OBJECT_KEY "__heap"
+		#define HEAP_PAUSE_BUDGET_DEFAULT 500
+		#define HEAP_THRESHOLD_MIN 0x100000
+		#define HEAP_TRACE_ALL ((size_t) INVALID)
+		#define HEAP_TRACE_CHUNK 0x10
+		#define HEAP_TRIGGER_RATIO_DEFAULT 2.0
+		#define HEAP_TRIGGER_RATIO_MIN 1.0
+
+		typedef std::chrono::steady_clock heap_clock_t;
+
+		typedef struct {
+			size_t collections;
+			double duration;
+			double pause_max;
+			size_t steps;
+			size_t steps_over_budget;
+			size_t bytes_live;
+			size_t bytes_reclaimed;
+			size_t objects_live;
+			size_t objects_promoted;
+			size_t objects_reclaimed;
+		} heap_stats_t, *heap_stats_ptr_t;
+
+		typedef void(*heap_collect_cb_t)(
+			__in const heap_stats_t &stats
+			);
+
+		typedef void(*heap_overrun_cb_t)(
+			__in double pause,
+			__in uint32_t pause_budget
+			);
+
+		typedef struct {
+			size_t bytes;
+			size_t cycle;
+			bool marked;
+			symbol_ptr sym;
+		} heap_object_t, *heap_object_ptr_t;
+
+		typedef struct {
+			scope_shared_t base;
+			scope_ptr scop;
+		} heap_root_t, *heap_root_ptr_t;
+
+		typedef class _heap {
+
+			public:
+
+				static _heap *acquire(
+					__in_opt generic_cb_t dest = NULL
+					);
+
+				void add_root(
+					__in scope_ptr root
+					);
+
+				void add_root(
+					__in symbol_ptr root
+					);
+
+				symbol_ptr allocate(
+					__in scope_sym_t type
+					);
+
+				void clear(void);
+
+				void collect(void);
+
+				void destroy(void);
+
+				size_t get_bytes(void);
+
+				size_t get_collection_count(void);
+
+				size_t get_limit(void);
+
+				symbol_ptr get_object(
+					__in const uuid &id
+					);
+
+				uint32_t get_pause_budget(void);
+
+				heap_phase_t get_phase(void);
+
+				heap_stats_t get_stats(void);
+
+				double get_trigger_ratio(void);
+
+				bool has_object(
+					__in symbol_ptr sym
+					);
+
+				void initialize(
+					__in_opt uint32_t pause_budget = HEAP_PAUSE_BUDGET_DEFAULT
+					);
+
+				bool is_initialized(void);
+
+				static bool is_marking(void);
+
+				void remove_root(
+					__in scope_ptr root
+					);
+
+				void remove_root(
+					__in symbol_ptr root
+					);
+
+				void root_barrier(
+					__in const scope_shared_t &base
+					);
+
+				void root_barrier(
+					__in symbol_ptr sym
+					);
+
+				void scan_barrier(
+					__in symbol_ptr sym
+					);
+
+				void set_callback(
+					__in_opt heap_collect_cb_t callback = NULL
+					);
+
+				void set_limit(
+					__in size_t limit
+					);
+
+				void set_overrun_callback(
+					__in_opt heap_overrun_cb_t callback = NULL
+					);
+
+				void set_pause_budget(
+					__in uint32_t pause_budget
+					);
+
+				void set_trigger_ratio(
+					__in double ratio
+					);
+
+				size_t size(void);
+
+				bool step(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+				void write_barrier(
+					__in const uuid &target
+					);
+
+				void write_barrier(
+					__in symbol_ptr target
+					);
+
+			protected:
+
+				friend void heap_destroy(void);
+
+				_heap(
+					__in_opt generic_cb_t dest = NULL
+					);
+
+				_heap(
+					__in const _heap &other
+					);
+
+				~_heap(void);
+
+				_heap &operator=(
+					__in const _heap &other
+					);
+
+				bool advance(
+					__in uint32_t pause_budget
+					);
+
+				void collect_roots(void);
+
+				bool mark_root(void);
+
+				static size_t measure(
+					__in symbol_ptr sym
+					);
+
+				void push_root(
+					__in scope_ptr root,
+					__in_opt const scope_shared_t &base = scope_shared_t()
+					);
+
+				void release(
+					__in size_t index
+					);
+
+				void shade(
+					__in symbol_ptr sym
+					);
+
+				bool trace(
+					__in symbol_ptr sym,
+					__inout size_t &position,
+					__in_opt size_t count = HEAP_TRACE_ALL
+					);
+
+				size_t m_bytes;
+
+				heap_collect_cb_t m_callback;
+
+				size_t m_collection_count;
+
+				heap_stats_t m_cycle;
+
+				std::vector<symbol_ptr> m_gray_list;
+
+				std::unordered_map<uuid, symbol_ptr> m_id_map;
+
+				bool m_initialized;
+
+				static _heap *m_instance;
+
+				size_t m_limit;
+
+				static std::atomic<bool> m_marking;
+
+				std::unordered_map<symbol_ptr, size_t> m_object_map;
+
+				std::vector<heap_object_t> m_object_list;
+
+				heap_overrun_cb_t m_overrun_callback;
+
+				uint32_t m_pause_budget;
+
+				heap_phase_t m_phase;
+
+				size_t m_root_element;
+
+				std::vector<heap_root_t> m_root_list;
+
+				size_t m_root_position;
+
+				std::unordered_map<scope_ptr, size_t> m_root_scope_map;
+
+				size_t m_root_slot;
+
+				std::vector<symbol_ptr> m_root_symbol_list;
+
+				std::unordered_map<symbol_ptr, size_t> m_root_symbol_map;
+
+				size_t m_root_symbol_position;
+
+				symbol_ptr m_root_trace;
+
+				heap_stats_t m_stats;
+
+				size_t m_sweep_position;
+
+				size_t m_threshold;
+
+				size_t m_trace_position;
+
+				symbol_ptr m_trace_symbol;
+
+				double m_trigger_ratio;
+
+				double m_unit_max;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} heap, *heap_ptr;
+	}
+}
+
+#endif // LUNA_HEAP_H_
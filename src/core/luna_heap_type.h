@@ -0,0 +1,64 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LUNA_HEAP_TYPE_H_
+#define LUNA_HEAP_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_HEAP_EXCEPTION_ALLOC_FAILED = 0,
+			LUNA_HEAP_EXCEPTION_INVALID_BUDGET,
+			LUNA_HEAP_EXCEPTION_INVALID_OBJECT,
+			LUNA_HEAP_EXCEPTION_INVALID_RATIO,
+			LUNA_HEAP_EXCEPTION_INVALID_ROOT,
+			LUNA_HEAP_EXCEPTION_INVALID_TYPE,
+			LUNA_HEAP_EXCEPTION_LIMIT_EXCEEDED,
+			LUNA_HEAP_EXCEPTION_UNINITIALIZED,
+		};
+
+		static const std::string LUNA_HEAP_EXCEPTION_STR[] = {
+			"Heap allocation failed",
+			"Invalid heap pause budget",
+			"Invalid heap object",
+			"Invalid heap trigger ratio",
+			"Invalid heap root",
+			"Invalid heap object type",
+			"Heap size limit exceeded",
+			"Heap uninitialized",
+			};
+
+		#define LUNA_HEAP_EXCEPTION_MAX LUNA_HEAP_EXCEPTION_UNINITIALIZED
+
+		#define LUNA_HEAP_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_HEAP_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_HEAP_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_HEAP_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_HEAP_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_HEAP_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_HEAP_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _heap;
+		typedef _heap heap, *heap_ptr;
+	}
+}
+
+#endif // LUNA_HEAP_TYPE_H_
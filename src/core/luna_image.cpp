@@ -0,0 +1,448 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstring>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+#include "luna.h"
+#include "luna_image_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		#define IMAGE_HASH_OFFSET 0xcbf29ce484222325ULL
+		#define IMAGE_HASH_PRIME 0x100000001b3ULL
+
+		image_hash_t 
+		image_hash(
+			__in const std::string &text
+			)
+		{
+			size_t iter;
+			image_hash_t result = IMAGE_HASH_OFFSET;
+
+			TRACE_ENTRY();
+
+			for(iter = 0; iter < text.size(); ++iter) {
+				result ^= (uint8_t) text[iter];
+				result *= IMAGE_HASH_PRIME;
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		std::string 
+		image_path(
+			__in const std::string &directory,
+			__in const std::string &text
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+
+			if(!directory.empty()) {
+				result << directory;
+
+				if(directory.back() != '/') {
+					result << "/";
+				}
+			}
+
+			result << VALUE_AS_HEX(image_hash_t, image_hash(text)) << IMAGE_EXTENSION;
+
+			TRACE_EXIT("Return Value: %s", result.str().c_str());
+			return result.str();
+		}
+
+		_image_reader::_image_reader(void) :
+			m_data(NULL),
+			m_length(0),
+			m_position(0)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_image_reader::~_image_reader(void)
+		{
+			TRACE_ENTRY();
+
+			close();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_image_reader::close(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+#ifndef _WIN32
+			if(m_data && m_data_copy.empty()) {
+				munmap((void *) m_data, m_length);
+			}
+#endif // _WIN32
+
+			m_data = NULL;
+			m_data_copy.clear();
+			m_length = 0;
+			m_position = 0;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		const image_header_t &
+		_image_reader::get_header(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_data) {
+				THROW_LUNA_IMAGE_EXCEPTION(LUNA_IMAGE_EXCEPTION_IMAGE_NOT_OPEN);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return *((const image_header_t *) m_data);
+		}
+
+		bool 
+		_image_reader::is_open(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_data != NULL);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_image_reader::open(
+			__in const std::string &path
+			)
+		{
+			bool result = false;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			close();
+
+#ifndef _WIN32
+			int file;
+			struct stat status;
+
+			file = ::open(path.c_str(), O_RDONLY);
+			if(file >= 0) {
+
+				if(!fstat(file, &status) && (status.st_size >= (off_t) sizeof(image_header_t))) {
+					m_data = (const char *) mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+					if(m_data == MAP_FAILED) {
+						m_data = NULL;
+						::close(file);
+						THROW_LUNA_IMAGE_EXCEPTION_MESSAGE(LUNA_IMAGE_EXCEPTION_FILE_MAP_FAILED,
+							"%s", path.c_str());
+					}
+
+					m_length = status.st_size;
+				}
+
+				::close(file);
+			}
+#else
+			std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+
+			if(file) {
+				m_data_copy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+				if(m_data_copy.size() >= sizeof(image_header_t)) {
+					m_data = m_data_copy.data();
+					m_length = m_data_copy.size();
+				} else {
+					m_data_copy.clear();
+				}
+
+				file.close();
+			}
+#endif // _WIN32
+
+			if(m_data) {
+				const image_header_t &header = get_header();
+
+				result = ((header.magic == IMAGE_MAGIC) && (header.version == IMAGE_VERSION));
+				if(result) {
+					m_position = sizeof(image_header_t);
+				} else {
+					close();
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		const void *
+		_image_reader::read(
+			__in size_t length
+			)
+		{
+			const void *result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_data) {
+				THROW_LUNA_IMAGE_EXCEPTION(LUNA_IMAGE_EXCEPTION_IMAGE_NOT_OPEN);
+			}
+
+			if(length > (m_length - m_position)) {
+				THROW_LUNA_IMAGE_EXCEPTION_MESSAGE(LUNA_IMAGE_EXCEPTION_IMAGE_TRUNCATED,
+					"pos/len/max: %lu/%lu/%lu", m_position, length, m_length);
+			}
+
+			result = m_data + m_position;
+			m_position += length;
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		const void *
+		_image_reader::read_array(
+			__in size_t count,
+			__in size_t size
+			)
+		{
+			const void *result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_data) {
+				THROW_LUNA_IMAGE_EXCEPTION(LUNA_IMAGE_EXCEPTION_IMAGE_NOT_OPEN);
+			}
+
+			if(size && (count > ((m_length - m_position) / size))) {
+				THROW_LUNA_IMAGE_EXCEPTION_MESSAGE(LUNA_IMAGE_EXCEPTION_IMAGE_TRUNCATED,
+					"pos/cnt/max: %lu/%lu/%lu", m_position, count, m_length);
+			}
+
+			result = read(count * size);
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_image_reader::read_string(
+			__inout std::string &text
+			)
+		{
+			size_t length;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			length = read_value();
+			text.assign((const char *) read(length), length);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		uint64_t 
+		_image_reader::read_value(void)
+		{
+			uint64_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			memcpy(&result, read(sizeof(uint64_t)), sizeof(uint64_t));
+
+			TRACE_EXIT("Return Value: %llu", result);
+			return result;
+		}
+
+		size_t 
+		_image_reader::size(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %lu", m_length);
+			return m_length;
+		}
+
+		std::string 
+		_image_reader::to_string(void)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Bytes: " << m_length << ", Position: " << m_position;
+
+			if(m_data) {
+				const image_header_t &header = get_header();
+
+				result << ", Version: " << header.version << ", Hash: " 
+					<< VALUE_AS_HEX(image_hash_t, header.hash);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		_image_writer::_image_writer(
+			__in const std::string &text
+			)
+		{
+			image_header_t header;
+
+			TRACE_ENTRY();
+
+			header.magic = IMAGE_MAGIC;
+			header.version = IMAGE_VERSION;
+			header.hash = image_hash(text);
+			header.length = text.size();
+			write(&header, sizeof(image_header_t));
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_image_writer::~_image_writer(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_image_writer::save(
+			__in const std::string &path
+			)
+		{
+			std::string temp_path;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			temp_path = path + ".tmp";
+
+			std::ofstream file(temp_path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if(!file) {
+				THROW_LUNA_IMAGE_EXCEPTION_MESSAGE(LUNA_IMAGE_EXCEPTION_FILE_WRITE_FAILED,
+					"%s", temp_path.c_str());
+			}
+
+			file.write(m_data.data(), m_data.size());
+			file.close();
+
+			if(!file || std::rename(temp_path.c_str(), path.c_str())) {
+				std::remove(temp_path.c_str());
+				THROW_LUNA_IMAGE_EXCEPTION_MESSAGE(LUNA_IMAGE_EXCEPTION_FILE_WRITE_FAILED,
+					"%s", path.c_str());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_image_writer::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_data.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_image_writer::to_string(void)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Bytes: " << m_data.size() << ", Version: " << IMAGE_VERSION;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		void 
+		_image_writer::write(
+			__in const void *data,
+			__in size_t length
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_data.append((const char *) data, length);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_image_writer::write_string(
+			__in const std::string &text
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			write_value(text.size());
+			write(text.data(), text.size());
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_image_writer::write_value(
+			__in uint64_t value
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			write(&value, sizeof(uint64_t));
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+	}
+}
@@ -0,0 +1,186 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LUNA_IMAGE_H_
+#define LUNA_IMAGE_H_
+
+#include <cstring>
+#include <vector>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		#define IMAGE_EXTENSION ".lui"
+		#define IMAGE_MAGIC 0x49554e4c
+		#define IMAGE_VERSION 1
+
+		typedef uint64_t image_hash_t;
+
+		typedef struct {
+			uint32_t magic;
+			uint32_t version;
+			image_hash_t hash;
+			uint64_t length;
+		} image_header_t, *image_header_ptr_t;
+
+		image_hash_t image_hash(
+			__in const std::string &text
+			);
+
+		std::string image_path(
+			__in const std::string &directory,
+			__in const std::string &text
+			);
+
+		typedef class _image_reader {
+
+			public:
+
+				_image_reader(void);
+
+				virtual ~_image_reader(void);
+
+				void close(void);
+
+				const image_header_t &get_header(void);
+
+				bool is_open(void);
+
+				bool open(
+					__in const std::string &path
+					);
+
+				const void *read(
+					__in size_t length
+					);
+
+				const void *read_array(
+					__in size_t count,
+					__in size_t size
+					);
+
+				template<typename T> void read_list(
+					__inout std::vector<T> &list
+					)
+				{
+					size_t count = read_value();
+					const void *data = read_array(count, sizeof(T));
+
+					list.resize(count);
+					if(count) {
+						std::memcpy(&list[0], data, count * sizeof(T));
+					}
+				}
+
+				void read_string(
+					__inout std::string &text
+					);
+
+				uint64_t read_value(void);
+
+				size_t size(void);
+
+				std::string to_string(void);
+
+			protected:
+
+				_image_reader(
+					__in const _image_reader &other
+					);
+
+				_image_reader &operator=(
+					__in const _image_reader &other
+					);
+
+				const char *m_data;
+
+				std::string m_data_copy;
+
+				size_t m_length;
+
+				size_t m_position;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} image_reader, *image_reader_ptr;
+
+		typedef class _image_writer {
+
+			public:
+
+				_image_writer(
+					__in const std::string &text
+					);
+
+				virtual ~_image_writer(void);
+
+				void save(
+					__in const std::string &path
+					);
+
+				size_t size(void);
+
+				std::string to_string(void);
+
+				void write(
+					__in const void *data,
+					__in size_t length
+					);
+
+				template<typename T> void write_list(
+					__in const std::vector<T> &list
+					)
+				{
+					write_value(list.size());
+					write(list.data(), list.size() * sizeof(T));
+				}
+
+				void write_string(
+					__in const std::string &text
+					);
+
+				void write_value(
+					__in uint64_t value
+					);
+
+			protected:
+
+				_image_writer(
+					__in const _image_writer &other
+					);
+
+				_image_writer &operator=(
+					__in const _image_writer &other
+					);
+
+				std::string m_data;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} image_writer, *image_writer_ptr;
+	}
+}
+
+#endif // LUNA_IMAGE_H_
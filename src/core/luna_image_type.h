@@ -0,0 +1,59 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LUNA_IMAGE_TYPE_H_
+#define LUNA_IMAGE_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_IMAGE_EXCEPTION_FILE_MAP_FAILED = 0,
+			LUNA_IMAGE_EXCEPTION_FILE_WRITE_FAILED,
+			LUNA_IMAGE_EXCEPTION_IMAGE_NOT_OPEN,
+			LUNA_IMAGE_EXCEPTION_IMAGE_TRUNCATED,
+		};
+
+		static const std::string LUNA_IMAGE_EXCEPTION_STR[] = {
+			"Failed to map image file",
+			"Failed to write image file",
+			"Image is not open",
+			"Image is truncated",
+			};
+
+		#define LUNA_IMAGE_EXCEPTION_MAX LUNA_IMAGE_EXCEPTION_IMAGE_TRUNCATED
+
+		#define LUNA_IMAGE_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_IMAGE_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_IMAGE_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_IMAGE_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_IMAGE_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_IMAGE_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_IMAGE_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _image_reader;
+		typedef _image_reader image_reader, *image_reader_ptr;
+
+		class _image_writer;
+		typedef _image_writer image_writer, *image_writer_ptr;
+	}
+}
+
+#endif // LUNA_IMAGE_TYPE_H_
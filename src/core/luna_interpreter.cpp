@@ -24,7 +24,8 @@ namespace LUNA_NS {
 
 	namespace LUNA_RUNTIME_NS {
 	
-		_interpreter::_interpreter(void)
+		_interpreter::_interpreter(void) :
+			m_scope_depth(0)
 		{
 			TRACE_ENTRY();
 
@@ -36,7 +37,8 @@ namespace LUNA_NS {
 		_interpreter::_interpreter(
 			__in const std::string &input,
 			__in_opt bool is_file
-			)
+			) :
+				m_scope_depth(0)
 		{
 			TRACE_ENTRY();
 
@@ -49,7 +51,9 @@ namespace LUNA_NS {
 			__in const _interpreter &other
 			) :
 				parser(other),
-				m_scope_stack(other.m_scope_stack)
+				m_globals(other.m_globals),
+				m_resolver(other.m_resolver),
+				m_scope_depth(0)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -73,9 +77,10 @@ namespace LUNA_NS {
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
-				parser::operator=(other);
 				interpreter::clear();
-				m_scope_stack = other.m_scope_stack;
+				parser::operator=(other);
+				m_globals = other.m_globals;
+				m_resolver = other.m_resolver;
 			}
 
 			TRACE_EXIT("Return Value: 0x%p", this);
@@ -90,6 +95,7 @@ namespace LUNA_NS {
 
 			parser::reset();
 			flush_scopes();
+			m_resolver.clear();
 
 			// TODO: setup global scope here
 
@@ -98,18 +104,18 @@ namespace LUNA_NS {
 
 		void 
 		_interpreter::evaluate_assignment(
-			__in node_factory_ptr node_fact,
-			__in token_factory_ptr tok_fact,
-			__in node &node,
-			__in token &tok
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in size_t node,
+			__in size_t tok
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			
 			// TODO: evaluate_assignment
-			UNREF_PARAM(node_fact);
-			UNREF_PARAM(tok_fact);
+			UNREF_PARAM(arena);
+			UNREF_PARAM(tok_table);
 			UNREF_PARAM(node);
 			UNREF_PARAM(tok);
 			// ---
@@ -119,18 +125,18 @@ namespace LUNA_NS {
 
 		void 
 		_interpreter::evaluate_conditional_if(
-			__in node_factory_ptr node_fact,
-			__in token_factory_ptr tok_fact,
-			__in node &node,
-			__in token &tok
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in size_t node,
+			__in size_t tok
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			
 			// TODO: evaluate_conditional_if
-			UNREF_PARAM(node_fact);
-			UNREF_PARAM(tok_fact);
+			UNREF_PARAM(arena);
+			UNREF_PARAM(tok_table);
 			UNREF_PARAM(node);
 			UNREF_PARAM(tok);
 			// ---
@@ -140,18 +146,18 @@ namespace LUNA_NS {
 
 		void 
 		_interpreter::evaluate_conditional_while(
-			__in node_factory_ptr node_fact,
-			__in token_factory_ptr tok_fact,
-			__in node &node,
-			__in token &tok
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in size_t node,
+			__in size_t tok
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			
 			// TODO: evaluate_conditional_while
-			UNREF_PARAM(node_fact);
-			UNREF_PARAM(tok_fact);
+			UNREF_PARAM(arena);
+			UNREF_PARAM(tok_table);
 			UNREF_PARAM(node);
 			UNREF_PARAM(tok);
 			// ---
@@ -161,18 +167,18 @@ namespace LUNA_NS {
 
 		void 
 		_interpreter::evaluate_control(
-			__in node_factory_ptr node_fact,
-			__in token_factory_ptr tok_fact,
-			__in node &node,
-			__in token &tok
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in size_t node,
+			__in size_t tok
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			
 			// TODO: evaluate_control
-			UNREF_PARAM(node_fact);
-			UNREF_PARAM(tok_fact);
+			UNREF_PARAM(arena);
+			UNREF_PARAM(tok_table);
 			UNREF_PARAM(node);
 			UNREF_PARAM(tok);
 			// ---
@@ -182,18 +188,18 @@ namespace LUNA_NS {
 
 		void 
 		_interpreter::evaluate_function_call(
-			__in node_factory_ptr node_fact,
-			__in token_factory_ptr tok_fact,
-			__in node &node,
-			__in token &tok
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in size_t node,
+			__in size_t tok
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			
 			// TODO: evaluate_function_call
-			UNREF_PARAM(node_fact);
-			UNREF_PARAM(tok_fact);
+			UNREF_PARAM(arena);
+			UNREF_PARAM(tok_table);
 			UNREF_PARAM(node);
 			UNREF_PARAM(tok);
 			// ---
@@ -203,18 +209,18 @@ namespace LUNA_NS {
 				
 		void 
 		_interpreter::evaluate_print(
-			__in node_factory_ptr node_fact,
-			__in token_factory_ptr tok_fact,
-			__in node &node,
-			__in token &tok
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in size_t node,
+			__in size_t tok
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			
 			// TODO: evaluate_print
-			UNREF_PARAM(node_fact);
-			UNREF_PARAM(tok_fact);
+			UNREF_PARAM(arena);
+			UNREF_PARAM(tok_table);
 			UNREF_PARAM(node);
 			UNREF_PARAM(tok);
 			// ---
@@ -225,26 +231,136 @@ namespace LUNA_NS {
 		void 
 		_interpreter::flush_scopes(void)
 		{
+			heap_ptr hp;
 			scope_factory_ptr scop_fact;
+			scope_st_t::iterator frame_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(luna::is_globally_initialized()) {
 
+				hp = get_heap();
+				if(hp) {
+
+					for(frame_iter = m_scope_stack.begin(); frame_iter != m_scope_stack.end(); ++frame_iter) {
+						hp->remove_root(frame_iter->frame);
+					}
+				}
+
 				scop_fact = get_scope_factory();
 				if(scop_fact) {
 
-					while(!m_scope_stack.empty()) {
-						scop_fact->remove_scope(m_scope_stack.top());
-						pop_scope();
+					for(frame_iter = m_scope_stack.begin(); frame_iter != m_scope_stack.end(); ++frame_iter) {
+						scop_fact->remove_scope(frame_iter->handle);
 					}
 				}
 			}
 
+			m_scope_depth = 0;
+			m_scope_stack.clear();
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		scope_shared_t 
+		_interpreter::freeze_globals(void)
+		{
+			scope_shared_t result(new scope);
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result->copy_symbols(*get_scope(m_scope_depth - 1));
+			result->freeze();
+
+			TRACE_EXIT("Return Value: 0x%p", result.get());
+			return result;
+		}
+
+		symbol_ptr 
+		_interpreter::get_bound_symbol(
+			__in size_t node,
+			__in_opt bool writable
+			)
+		{
+			atom_t key;
+			size_t iter;
+			scope_ptr scop;
+			symbol_ptr result = NULL;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			binding_t &bound = m_resolver.get_binding(node);
+			key = m_token_table.get_atom(parser::get_node_arena()->get_node(node).token);
+
+			if(bound.depth != BINDING_DEPTH_DYNAMIC) {
+
+				scop = get_scope((bound.frame == RESOLVER_FRAME_GLOBAL) ? (m_scope_depth - 1) : bound.depth);
+
+				result = scop->get_frame_slot(bound.slot);
+				if(!result && scop->has_symbol(key)) {
+					scop->set_frame_slot(bound.slot, key);
+					result = scop->get_frame_slot(bound.slot);
+				}
+			} else {
+
+				for(iter = 0; iter < m_scope_depth; ++iter) {
+					scop = get_scope(iter);
+
+					if(scop->has_symbol(key)) {
+						result = scop->get_symbol(key);
+						break;
+					}
+				}
+			}
+
+			if(writable && result && result->is_frozen()) {
+				result = scop->detach_symbol(key);
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		scope_ptr 
+		_interpreter::get_scope(
+			__in size_t depth
+			)
+		{
+			scope_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(depth >= m_scope_depth) {
+				THROW_LUNA_INTERPRETER_EXCEPTION_MESSAGE(LUNA_INTERPRETER_EXCEPTION_NO_SCOPE,
+					"depth/max: %lu/%lu", depth, m_scope_depth);
+			}
+
+			result = m_scope_stack[m_scope_depth - depth - 1].frame;
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		heap_ptr 
+		_interpreter::get_heap(void)
+		{
+			heap_ptr result = NULL;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(luna::is_globally_initialized() && luna::acquire()->is_initialized()) {
+				result = luna::acquire()->acquire_heap();
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
 		scope_factory_ptr 
 		_interpreter::get_scope_factory(void)
 		{
@@ -256,7 +372,7 @@ namespace LUNA_NS {
 			if(luna::is_globally_initialized()) {
 				
 				if(get_context()->is_initialized()) {
-					result = get_context()->acquire_scope_factory();
+					result = m_context->get_scope_factory();
 				}
 			}
 
@@ -264,38 +380,135 @@ namespace LUNA_NS {
 			return result;
 		}
 
+		scope_ptr 
+		_interpreter::get_globals(void)
+		{
+			scope_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = get_scope(m_scope_depth - 1);
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		hash_cons_stats_t 
+		_interpreter::get_hash_cons_stats(void)
+		{
+			hash_cons_stats_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = parser::get_hash_cons_stats();
+
+			TRACE_EXIT("Return Value: %lu", result.bytes_saved);
+			return result;
+		}
+
+		bool 
+		_interpreter::load_image(
+			__in_opt const std::string &directory
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = parser::load_image(directory);
+			if(result) {
+				interpreter::clear();
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
 		void 
 		_interpreter::pop_scope(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(!m_scope_stack.empty()) {
+			if(!m_scope_depth) {
 				THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_NO_SCOPE);
 			}
 
-			if(luna::is_globally_initialized()) {
-				get_scope_factory()->remove_scope(m_scope_stack.top());
+			m_scope_stack[--m_scope_depth].frame->clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		handle_t 
+		_interpreter::push_scope(
+			__in_opt size_t frame_size
+			)
+		{
+			heap_ptr hp;
+			scope_frame_t frame;
+			scope_factory_ptr scop_fact;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_scope_depth == m_scope_stack.size()) {
+
+				scop_fact = get_scope_factory();
+				if(!scop_fact) {
+					THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_FACTORY_ALLOC_FAILED);
+				}
+
+				frame.handle = scop_fact->generate();
+				frame.frame = &scop_fact->get_scope(frame.handle);
+				m_scope_stack.push_back(frame);
+
+				hp = get_heap();
+				if(hp) {
+					hp->add_root(frame.frame);
+				}
 			}
 
-			m_scope_stack.pop();
+			frame = m_scope_stack[m_scope_depth++];
+			frame.frame->resize_frame(frame_size);
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			TRACE_EXIT("Return Value: 0x%x", frame.handle);
+			return frame.handle;
 		}
 
-		uuid 
-		_interpreter::push_scope(void)
+		void 
+		_interpreter::reset_scopes(void)
 		{
-			uuid result;
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			while(m_scope_depth) {
+				pop_scope();
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
 
+		void 
+		_interpreter::resolve(void)
+		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = get_scope_factory()->generate().get_id();
-			m_scope_stack.push(result);
+			parser::discover();
+			m_resolver.resolve(parser::get_node_arena(), m_token_table, m_statement_list);
+			reset_scopes();
+			push_scope(m_resolver.get_frame(RESOLVER_FRAME_GLOBAL).size);
+
+			if(m_globals) {
+				get_scope(m_scope_depth - 1)->set_base(m_globals);
+			}
+
+			parser::reset();
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return result;
 		}
 
 		void 
@@ -304,7 +517,7 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			parser::clear();
+			interpreter::resolve();
 
 			while(parser::has_next_statement()) {
 				step();
@@ -313,6 +526,22 @@ namespace LUNA_NS {
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		std::string 
+		_interpreter::save_image(
+			__in_opt const std::string &directory
+			)
+		{
+			std::string result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = parser::save_image(directory);
+
+			TRACE_EXIT("Return Value: %s", result.c_str());
+			return result;
+		}
+
 		void 
 		_interpreter::set(
 			__in const std::string &input,
@@ -328,13 +557,47 @@ namespace LUNA_NS {
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		void 
+		_interpreter::set_globals(
+			__in const scope_shared_t &globals
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(globals && !globals->is_frozen()) {
+				THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_GLOBALS_NOT_FROZEN);
+			}
+
+			m_globals = globals;
+
+			if(m_scope_depth) {
+				get_scope(m_scope_depth - 1)->set_base(m_globals);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_interpreter::set_hash_consing(
+			__in bool enabled
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			parser::set_hash_consing(enabled);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
 		void 
 		_interpreter::step(
 			__in_opt bool expect_next
 			)
 		{
-			node_factory_ptr node_fact;
-			token_factory_ptr tok_fact;
+			node_arena_ptr arena;
+			size_t left_child, right_child, stmt;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -343,74 +606,65 @@ namespace LUNA_NS {
 				THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_NO_NEXT_STATEMENT);
 			}
 
-			if(parser::get_statement().front().get_id() == parser::get_begin_statement().front().get_id()) {
+			if(parser::get_statement().first == parser::get_begin_statement().first) {
 				parser::move_next_statement();
 			}
 
 			if(parser::has_next_statement()) {
 				
-				node_fact = parser::get_node_factory();
-				if(!node_fact) {
-					THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_FACTORY_ALLOC_FAILED);
-				}
-
-				tok_fact = lexer::get_token_factory();
-				if(!tok_fact) {
-					THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_FACTORY_ALLOC_FAILED);
-				}
-
-				node &stmt_nd = node_fact->get_node(parser::get_statement().front());
-				token &stmt_tok = tok_fact->get_token(stmt_nd.get_token_id());
+				arena = parser::get_node_arena();
+				stmt = parser::get_statement().first;
+				size_t stmt_tok = arena->get_node(stmt).token;
 
-				if(!stmt_nd.get_child_count()
-						|| (stmt_tok.get_type() != TOKEN_STATEMENT)) {
+				if(arena->is_leaf(stmt)
+						|| (m_token_table.get_type(stmt_tok) != TOKEN_STATEMENT)) {
 					THROW_LUNA_INTERPRETER_EXCEPTION_MESSAGE(LUNA_INTERPRETER_EXCEPTION_EXPECTING_STATEMENT,
-						"%s", stmt_tok.to_string().c_str());
+						"%s", m_token_table.token_as_string(stmt_tok).c_str());
 				}
 
-				node &left_child_nd = node_fact->get_node(parser::get_statement().at(stmt_nd.get_child(0)));
-				token &left_child_tok = tok_fact->get_token(left_child_nd.get_token_id());
+				left_child = arena->get_child(stmt, 0);
+				size_t left_child_tok = arena->get_node(left_child).token;
 
-				switch(left_child_tok.get_type()) {
+				switch(m_token_table.get_type(left_child_tok)) {
 					case TOKEN_CONTROL:
-						evaluate_control(node_fact, tok_fact, stmt_nd, stmt_tok);
+						evaluate_control(arena, m_token_table, stmt, stmt_tok);
 						break;
 					case TOKEN_IDENTIFIER: {
-							node &right_child_nd = node_fact->get_node(parser::get_statement().at(stmt_nd.get_child(1)));
-							token &right_child_tok = tok_fact->get_token(right_child_nd.get_token_id());
+							right_child = arena->get_child(stmt, 1);
+							size_t right_child_tok = arena->get_node(right_child).token;
 
-							switch(right_child_tok.get_type()) {
+							switch(m_token_table.get_type(right_child_tok)) {
 								case TOKEN_ASSIGNMENT:
-									evaluate_assignment(node_fact, tok_fact, stmt_nd, stmt_tok);
+									evaluate_assignment(arena, m_token_table, stmt, stmt_tok);
 									break;
 								case TOKEN_FUNCTION_CALL:
-									evaluate_function_call(node_fact, tok_fact, stmt_nd, stmt_tok);
+									evaluate_function_call(arena, m_token_table, stmt, stmt_tok);
 									break;
 								default:
 									THROW_LUNA_INTERPRETER_EXCEPTION_MESSAGE(LUNA_INTERPRETER_EXCEPTION_EXPECTING_ASSIGNMENT,
-										"%s", right_child_tok.to_string().c_str());
+										"%s", m_token_table.token_as_string(right_child_tok).c_str());
 							}
 						} break;
 					case TOKEN_KEYWORD:
 
-						switch(left_child_tok.get_subtype()) {
+						switch(m_token_table.get_subtype(left_child_tok)) {
 						case KEYWORD_IF:
-							evaluate_conditional_if(node_fact, tok_fact, stmt_nd, stmt_tok);
+							evaluate_conditional_if(arena, m_token_table, stmt, stmt_tok);
 							break;
 						case KEYWORD_WHILE:
-							evaluate_conditional_while(node_fact, tok_fact, stmt_nd, stmt_tok);
+							evaluate_conditional_while(arena, m_token_table, stmt, stmt_tok);
 							break;
 						case KEYWORD_PRINT:
-							evaluate_print(node_fact, tok_fact, stmt_nd, stmt_tok);
+							evaluate_print(arena, m_token_table, stmt, stmt_tok);
 							break;
 						default:
 							THROW_LUNA_INTERPRETER_EXCEPTION_MESSAGE(LUNA_INTERPRETER_EXCEPTION_EXPECTING_CONDITIONAL,
-								"%s", left_child_tok.to_string().c_str());
+								"%s", m_token_table.token_as_string(left_child_tok).c_str());
 						}
 						break;
 					default:
 						THROW_LUNA_INTERPRETER_EXCEPTION_MESSAGE(LUNA_INTERPRETER_EXCEPTION_EXPECTING_STATEMENT,
-							"%s", left_child_tok.to_string().c_str());
+							"%s", m_token_table.token_as_string(left_child_tok).c_str());
 				}
 
 				if(parser::has_next_statement()) {
@@ -429,18 +683,16 @@ namespace LUNA_NS {
 			)
 		{
 			std::stringstream result;
-			scope_factory_ptr scop_fact;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			scop_fact = get_scope_factory();
-			if(!scop_fact) {
-				THROW_LUNA_INTERPRETER_EXCEPTION(LUNA_INTERPRETER_EXCEPTION_FACTORY_ALLOC_FAILED);
-			}
-
 			result << parser::to_string(verbose) << std::endl << "---" << std::endl 
-				<< scop_fact->get_scope(m_scope_stack.top()).to_string(verbose);
+				<< "Frames: " << m_scope_depth << "/" << m_scope_stack.size();
+
+			if(m_scope_depth) {
+				result << std::endl << get_scope(0)->to_string(verbose);
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
@@ -20,7 +20,7 @@
 #ifndef LUNA_INTERPRETER_H_
 #define LUNA_INTERPRETER_H_
 
-#include <stack>
+#include <vector>
 
 namespace LUNA_NS {
 
@@ -28,7 +28,12 @@ namespace LUNA_NS {
 
 	namespace LUNA_RUNTIME_NS {
 		
-		typedef std::stack<uuid> scope_st_t, *scope_st_ptr_t;
+		typedef struct {
+			handle_t handle;
+			scope_ptr frame;
+		} scope_frame_t, *scope_frame_ptr_t;
+
+		typedef std::vector<scope_frame_t> scope_st_t, *scope_st_ptr_t;
 
 		typedef class _interpreter :
 				protected parser {
@@ -54,13 +59,37 @@ namespace LUNA_NS {
 
 				virtual void clear(void);
 
+				scope_shared_t freeze_globals(void);
+
+				scope_ptr get_globals(void);
+
+				hash_cons_stats_t get_hash_cons_stats(void);
+
+				bool load_image(
+					__in_opt const std::string &directory = std::string()
+					);
+
+				void resolve(void);
+
 				void run(void);
 
+				std::string save_image(
+					__in_opt const std::string &directory = std::string()
+					);
+
 				virtual void set(
 					__in const std::string &input,
 					__in_opt bool is_file = false
 					);
 
+				void set_globals(
+					__in const scope_shared_t &globals
+					);
+
+				void set_hash_consing(
+					__in bool enabled
+					);
+
 				void step(
 					__in_opt bool expect_next = false
 					);
@@ -72,54 +101,75 @@ namespace LUNA_NS {
 			protected:
 
 				void evaluate_assignment(
-					__in node_factory_ptr node_fact,
-					__in token_factory_ptr tok_fact,
-					__in node &node,
-					__in token &tok
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in size_t node,
+					__in size_t tok
 					);
 
 				void evaluate_conditional_if(
-					__in node_factory_ptr node_fact,
-					__in token_factory_ptr tok_fact,
-					__in node &node,
-					__in token &tok
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in size_t node,
+					__in size_t tok
 					);
 
 				void evaluate_conditional_while(
-					__in node_factory_ptr node_fact,
-					__in token_factory_ptr tok_fact,
-					__in node &node,
-					__in token &tok
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in size_t node,
+					__in size_t tok
 					);
 
 				void evaluate_control(
-					__in node_factory_ptr node_fact,
-					__in token_factory_ptr tok_fact,
-					__in node &node,
-					__in token &tok
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in size_t node,
+					__in size_t tok
 					);
 
 				void evaluate_function_call(
-					__in node_factory_ptr node_fact,
-					__in token_factory_ptr tok_fact,
-					__in node &node,
-					__in token &tok
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in size_t node,
+					__in size_t tok
 					);
 				
 				void evaluate_print(
-					__in node_factory_ptr node_fact,
-					__in token_factory_ptr tok_fact,
-					__in node &node,
-					__in token &tok
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in size_t node,
+					__in size_t tok
 					);
 
 				void flush_scopes(void);
 
+				symbol_ptr get_bound_symbol(
+					__in size_t node,
+					__in_opt bool writable = false
+					);
+
+				heap_ptr get_heap(void);
+
+				scope_ptr get_scope(
+					__in size_t depth
+					);
+
 				scope_factory_ptr get_scope_factory(void);
 
 				void pop_scope(void);
 
-				uuid push_scope(void);
+				handle_t push_scope(
+					__in_opt size_t frame_size = 0
+					);
+
+				void reset_scopes(void);
+
+				scope_shared_t m_globals;
+
+				resolver m_resolver;
+
+				size_t m_scope_depth;
 
 				scope_st_t m_scope_stack;
 
@@ -30,6 +30,7 @@ namespace LUNA_NS {
 			LUNA_INTERPRETER_EXCEPTION_EXPECTING_NEXT_STATEMENT,
 			LUNA_INTERPRETER_EXCEPTION_EXPECTING_STATEMENT,
 			LUNA_INTERPRETER_EXCEPTION_FACTORY_ALLOC_FAILED,
+			LUNA_INTERPRETER_EXCEPTION_GLOBALS_NOT_FROZEN,
 			LUNA_INTERPRETER_EXCEPTION_NO_SCOPE,
 			LUNA_INTERPRETER_EXCEPTION_NO_NEXT_STATEMENT,
 		};
@@ -39,6 +40,7 @@ namespace LUNA_NS {
 			"Expecting a conditional statement",
 			"Expecting a statement",
 			"Factory allocation failed",
+			"Global scope is not frozen",
 			"No scope found",
 			"No next statement to step to",
 			};
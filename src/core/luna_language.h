@@ -199,7 +199,7 @@ namespace LUNA_NS {
 		#define OPERATOR_MAX OPERATOR_SHIFT_RIGHT
 
 		static const std::string OPERATOR_STR[] = {
-			"&&", "==", ">", ">=", "<", "<=", "~=", "||",
+			"&&", "==", ">", ">=", "<", "<=", "~=", "||", "<<", ">>",
 			};
 
 		#define OPERATOR_STRING(_TYPE_)\
@@ -478,9 +478,13 @@ namespace LUNA_NS {
 			) :
 				lexer_base(other),
 				m_token_list(other.m_token_list),
-				m_token_position(other.m_token_position)
+				m_token_position(other.m_token_position),
+				m_token_table(other.m_token_table)
 		{
 			TRACE_ENTRY();
+
+			m_token_table.set_buffer(&m_text);
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
@@ -506,6 +510,8 @@ namespace LUNA_NS {
 				lexer::clear();
 				m_token_list = other.m_token_list;
 				m_token_position = other.m_token_position;
+				m_token_table = other.m_token_table;
+				m_token_table.set_buffer(&m_text);
 			}
 
 			TRACE_EXIT("Return Value: 0x%p", this);
@@ -514,15 +520,15 @@ namespace LUNA_NS {
 
 		void 
 		_lexer::add_token(
-			__in const uuid &id
+			__in size_t row
 			)
 		{
-			add_token(id, m_token_position + 1);
+			add_token(row, m_token_position + 1);
 		}
 
 		void 
 		_lexer::add_token(
-			__in const uuid &id,
+			__in size_t row,
 			__in size_t position
 			)
 		{
@@ -535,9 +541,9 @@ namespace LUNA_NS {
 			}
 
 			if(position < m_token_list.size()) {
-				m_token_list.insert(m_token_list.begin() + position, id);
+				m_token_list.insert(m_token_list.begin() + position, row);
 			} else {
-				m_token_list.push_back(id);
+				m_token_list.push_back(row);
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -546,63 +552,65 @@ namespace LUNA_NS {
 		void 
 		_lexer::clear(void)
 		{
-			token_factory_ptr tok_fact;
-			std::vector<uuid>::iterator id_iter;
-
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			lexer_base::reset();
 			skip_whitespace();
 
-			tok_fact = get_token_factory();
-			if(tok_fact) {
-
-				for(id_iter = m_token_list.begin(); id_iter != m_token_list.end(); ++id_iter) {
-					tok_fact->remove_token(*id_iter);
-				}
-			}
-
 			m_token_list.clear();
+			m_token_table.clear();
+			m_token_table.set_buffer(&m_text);
+			m_token_table.set_source(lexer_base::get_source());
 
-			if(tok_fact) {
-				m_token_list.push_back(create_token(TOKEN_BEGIN));
-				m_token_list.push_back(create_token(TOKEN_END));
-			}
-
+			m_token_list.push_back(create_token(TOKEN_BEGIN));
+			m_token_list.push_back(create_token(TOKEN_END));
 			m_token_position = 0;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		uuid 
+		size_t 
 		_lexer::create_token(
 			__in_opt token_t type,
 			__in_opt uint32_t subtype,
 			__in_opt const std::string &text,
-			__in_opt const std::string &source,
 			__in_opt size_t line,
-			__in_opt double value
+			__in_opt double value,
+			__in_opt atom_t atom
 			)	
 		{
-			token tok(type, subtype);
-			token_factory_ptr tok_fact;
+			size_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			tok_fact = get_token_factory();
-			if(!tok_fact) {
-				THROW_LUNA_LEXER_EXCEPTION(LUNA_LEXER_EXCEPTION_FACTORY_ALLOC_FAILED);
-			}
+			result = m_token_table.add_token(type, subtype, text, line, value, atom);
 
-			tok.set_text(text);
-			tok.set_value(value);
-			tok.set_source(source, line);
-			tok_fact->add_token(tok.get_id(), tok);
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
 
-			TRACE_EXIT("Return Value: %s", tok.to_string().c_str());
-			return tok.get_id();
+		size_t 
+		_lexer::create_token_slice(
+			__in token_t type,
+			__in uint32_t subtype,
+			__in size_t offset,
+			__in size_t length,
+			__in_opt size_t line,
+			__in_opt double value,
+			__in_opt atom_t atom
+			)	
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_token_table.add_token_slice(type, subtype, offset, length, line, value, atom);
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
 		}
 
 		size_t 
@@ -628,8 +636,8 @@ namespace LUNA_NS {
 		void 
 		_lexer::enumerate_alpha_token(void)
 		{
-			size_t line;
 			std::string text;
+			size_t length = 0, line, offset;
 			token_t type = TOKEN_IDENTIFIER;
 			uint32_t subtype = TOKEN_SUBTYPE_INVALID;
 
@@ -643,7 +651,8 @@ namespace LUNA_NS {
 			}
 
 			line = lexer_base::get_character_row();
-			text += lexer_base::get_character();
+			offset = lexer_base::get_character_position();
+			++length;
 			lexer_base::move_next_character();
 
 			for(;;) {
@@ -654,7 +663,7 @@ namespace LUNA_NS {
 					break;
 				}
 
-				text += lexer_base::get_character();
+				++length;
 
 				if(!lexer_base::has_next_character()) {
 					break;
@@ -663,25 +672,24 @@ namespace LUNA_NS {
 				lexer_base::move_next_character();
 			}
 
+			text.assign(m_text, offset, length);
+
 			if(IS_BOOLEAN(text)) {
 				type = TOKEN_BOOLEAN;
-				subtype = determine_token_subtype(text, type);
-				text.clear();
 			} else if(IS_CONTROL(text)) {
 				type = TOKEN_CONTROL;
-				subtype = determine_token_subtype(text, type);
-				text.clear();
 			} else if(IS_KEYWORD(text)) {
 				type = TOKEN_KEYWORD;
-				subtype = determine_token_subtype(text, type);
-				text.clear();
 			} else if(IS_NULL(text)) {
 				type = TOKEN_NULL;
-				subtype = determine_token_subtype(text, type);
-				text.clear();
 			}
 
-			add_token(create_token(type, subtype, text, lexer_base::get_source(), line).get_id());
+			if(type == TOKEN_IDENTIFIER) {
+				add_token(create_token_slice(type, subtype, offset, length, line, 0, generate_atom(text)));
+			} else {
+				subtype = determine_token_subtype(text, type);
+				add_token(create_token(type, subtype, std::string(), line));
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -690,8 +698,8 @@ namespace LUNA_NS {
 		_lexer::enumerate_digit_token(void)
 		{
 			char ch;
-			size_t line;
 			std::string text;
+			size_t length = 0, line, offset;
 			double value = 0;
 			token_t type = TOKEN_SCALAR;
 			uint32_t subtype = SCALAR_DECIMAL;
@@ -708,10 +716,13 @@ namespace LUNA_NS {
 			line = lexer_base::get_character_row();
 			ch = lexer_base::get_character();
 			enumerate_digit_token_subtype(subtype);
+			offset = lexer_base::get_character_position();
 
 			if((subtype != SCALAR_BINARY)
 					&& (subtype != SCALAR_HEXIDECIMAL)) {
-				text += ch;
+				++length;
+			} else {
+				++offset;
 			}
 
 			for(;;) {
@@ -780,17 +791,17 @@ namespace LUNA_NS {
 					break;
 				}
 
-				text += ch;
+				++length;
 			}
 
-			if(text.empty()) {
+			if(!length) {
 				THROW_LUNA_LEXER_EXCEPTION_MESSAGE(LUNA_LEXER_EXCEPTION_INVALID_SCALAR_VALUE,
 					"%s", lexer_base::to_string().c_str());
 			}
 
+			text.assign(m_text, offset, length);
 			enumerate_digit_token_value(value, text, type, subtype);
-			text.clear();
-			add_token(create_token(type, subtype, text, lexer_base::get_source(), line, value).get_id());
+			add_token(create_token(type, subtype, std::string(), line, value));
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -1036,10 +1047,13 @@ namespace LUNA_NS {
 		_lexer::enumerate_literal_string_token(
 			__inout token_t &type,
 			__inout std::string &text,
+			__inout size_t &offset,
+			__inout size_t &length,
 			__in size_t line
 			)
 		{
 			char ch;
+			bool escaped = false;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -1058,6 +1072,8 @@ namespace LUNA_NS {
 			}
 
 			ch = lexer_base::move_next_character();
+			offset = lexer_base::get_character_position();
+			length = 0;
 
 			for(;;) {
 						
@@ -1071,13 +1087,28 @@ namespace LUNA_NS {
 				}
 
 				if(ch == CHARACTER_ESCAPE) {
+
+					if(!escaped) {
+						text.assign(m_text, offset, length);
+						escaped = true;
+					}
+
 					enumerate_escape_character(ch);
 				}
 
-				text += ch;
+				if(escaped) {
+					text += ch;
+				} else {
+					++length;
+				}
+
 				ch = lexer_base::move_next_character();
 			}
 
+			if(escaped) {
+				length = text.size();
+			}
+
 			if(lexer_base::has_next_character()) {
 				lexer_base::move_next_character();
 			}
@@ -1089,8 +1120,8 @@ namespace LUNA_NS {
 		_lexer::enumerate_symbol_token(void)
 		{
 			char ch;
-			size_t line;
 			std::string text;
+			size_t length = 0, line, offset = 0;
 			double value = 0;
 			bool add_tok = true;
 			token_t type = TOKEN_SYMBOL;
@@ -1112,7 +1143,7 @@ namespace LUNA_NS {
 					enumerate_literal_character_token(type, value, line);
 					break;
 				case CHARACTER_DELIMITER_STRING:
-					enumerate_literal_string_token(type, text, line);
+					enumerate_literal_string_token(type, text, offset, length, line);
 					break;
 				case CHARACTER_UNDERSCORE:
 					enumerate_alpha_token();
@@ -1124,7 +1155,13 @@ namespace LUNA_NS {
 			}
 
 			if(add_tok) {
-				add_token(create_token(type, subtype, text, lexer_base::get_source(), line, value).get_id());
+
+				if(text.empty() && length) {
+					add_token(create_token_slice(type, subtype, offset, length, line, value, 
+						generate_atom(std::string(m_text, offset, length))));
+				} else {
+					add_token(create_token(type, subtype, text, line, value, generate_atom(text)));
+				}
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -1214,30 +1251,41 @@ namespace LUNA_NS {
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		token &
-		_lexer::get_begin_token(void)
+		atom_t 
+		_lexer::get_token_atom(void)
 		{
-			return get_token(0);
+			atom_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_token_table.get_atom(get_token_row());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
-		token &
-		_lexer::get_end_token(void)
+		size_t 
+		_lexer::get_token_position(void)
 		{
-			return get_token(m_token_list.size() - 1);
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %lu", m_token_position);
+			return m_token_position;
 		}
 
-		token &
-		_lexer::get_token(void)
+		size_t 
+		_lexer::get_token_row(void)
 		{
-			return get_token(m_token_position);
+			return get_token_row(m_token_position);
 		}
 
-		token &
-		_lexer::get_token(
+		size_t 
+		_lexer::get_token_row(
 			__in size_t position
 			)
 		{
-			token_factory_ptr tok_fact;
+			size_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -1247,41 +1295,89 @@ namespace LUNA_NS {
 					"pos/max: %lu/%lu", position, (m_token_list.size() - 1));
 			}
 
-			tok_fact = get_token_factory();
-			if(!tok_fact) {
-				THROW_LUNA_LEXER_EXCEPTION(LUNA_LEXER_EXCEPTION_FACTORY_ALLOC_FAILED);
-			}
+			result = m_token_list.at(position);
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return tok_fact->get_token(m_token_list.at(position));
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
 		}
 
-		token_factory_ptr 
-		_lexer::get_token_factory(void)
+		uint32_t 
+		_lexer::get_token_subtype(void)
 		{
-			token_factory_ptr result = NULL;
+			uint32_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(luna::is_globally_initialized()) {
+			result = m_token_table.get_subtype(get_token_row());
 
-				if(get_context()->is_initialized()) {
-					result = get_context()->acquire_token_factory();
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		token_table &
+		_lexer::get_token_table(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", &m_token_table);
+			return m_token_table;
+		}
+
+		token_t 
+		_lexer::get_token_type(void)
+		{
+			token_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_token_table.get_type(get_token_row());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		atom_t 
+		_lexer::generate_atom(
+			__in const std::string &text
+			)
+		{
+			atom_factory_ptr atom_fact;
+			atom_t result = ATOM_INVALID;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!text.empty()) {
+
+				atom_fact = get_atom_factory();
+				if(atom_fact) {
+					result = atom_fact->generate(text);
 				}
 			}
 
-			TRACE_EXIT("Return Value: 0x%p", result);
+			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
-		size_t 
-		_lexer::get_token_position(void)
+		atom_factory_ptr 
+		_lexer::get_atom_factory(void)
 		{
+			atom_factory_ptr result = NULL;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT("Return Value: %lu", m_token_position);
-			return m_token_position;
+
+			if(luna::is_globally_initialized()) {
+
+				if(get_context()->is_initialized()) {
+					result = get_context()->acquire_atom_factory();
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
 		}
 
 		bool 
@@ -1292,7 +1388,7 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = (get_token().get_type() != TOKEN_END);
+			result = (get_token_type() != TOKEN_END);
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
@@ -1312,7 +1408,58 @@ namespace LUNA_NS {
 			return result;
 		}
 
-		token &
+		void 
+		_lexer::load(
+			__in image_reader &reader
+			)
+		{
+			size_t count, iter, row;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_char_column = reader.read_value();
+			m_char_position = reader.read_value();
+			m_char_row = reader.read_value();
+			m_char_type = (char_t) reader.read_value();
+			m_char_column_map.clear();
+
+			count = reader.read_value();
+			for(iter = 0; iter < count; ++iter) {
+				row = reader.read_value();
+				m_char_column_map.insert(std::pair<size_t, size_t>(row, reader.read_value()));
+			}
+
+			reader.read_list(m_token_list);
+			m_token_position = reader.read_value();
+			m_token_table.load(reader);
+
+			if(m_token_list.size() < SENTINEL_COUNT) {
+				THROW_LUNA_LEXER_EXCEPTION_MESSAGE(LUNA_LEXER_EXCEPTION_INVALID_TOKEN_POSITION,
+					"pos/max: %lu/%lu", m_token_position, m_token_list.size());
+			}
+
+			for(iter = 0; iter < m_token_list.size(); ++iter) {
+
+				if(m_token_list[iter] >= m_token_table.size()) {
+					THROW_LUNA_LEXER_EXCEPTION_MESSAGE(LUNA_LEXER_EXCEPTION_INVALID_TOKEN_POSITION,
+						"row/max: %lu/%lu", m_token_list[iter], m_token_table.size());
+				}
+			}
+
+			for(row = 0; row < m_token_table.size(); ++row) {
+
+				if(m_token_table.get_atom(row) != ATOM_INVALID) {
+					m_token_table.set_atom(row, generate_atom(m_token_table.get_text(row)));
+				}
+			}
+
+			get_token_row();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
 		_lexer::move_next_token(
 			__in bool expect_next
 			)
@@ -1334,10 +1481,10 @@ namespace LUNA_NS {
 			++m_token_position;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return get_token();
+			return get_token_row();
 		}
 
-		token &
+		size_t 
 		_lexer::move_previous_token(
 			__in bool expect_previous
 			)
@@ -1353,7 +1500,7 @@ namespace LUNA_NS {
 			--m_token_position;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return get_token();
+			return get_token_row();
 		}
 
 		void 
@@ -1367,6 +1514,34 @@ namespace LUNA_NS {
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		void 
+		_lexer::save(
+			__in image_writer &writer
+			)
+		{
+			std::map<size_t, size_t>::iterator column_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			writer.write_value(m_char_column);
+			writer.write_value(m_char_position);
+			writer.write_value(m_char_row);
+			writer.write_value(m_char_type);
+			writer.write_value(m_char_column_map.size());
+
+			for(column_iter = m_char_column_map.begin(); column_iter != m_char_column_map.end(); ++column_iter) {
+				writer.write_value(column_iter->first);
+				writer.write_value(column_iter->second);
+			}
+
+			writer.write_list(m_token_list);
+			writer.write_value(m_token_position);
+			m_token_table.save(writer);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
 		void 
 		_lexer::set(
 			__in const std::string &input,
@@ -1450,7 +1625,7 @@ namespace LUNA_NS {
 				result << "(" << m_token_position << "/" << (m_token_list.size() - 1) << ") ";
 			}
 
-			result << get_token().to_string(verbose);
+			result << m_token_table.token_as_string(get_token_row(), verbose);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
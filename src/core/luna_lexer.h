@@ -148,27 +148,31 @@ namespace LUNA_NS {
 
 				virtual size_t discover(void);
 
-				token &get_begin_token(void);
+				atom_t get_token_atom(void);
 
-				token &get_end_token(void);
+				size_t get_token_position(void);
 
-				token &get_token(void);
+				size_t get_token_row(void);
 
-				token &get_token(
+				size_t get_token_row(
 					__in size_t position
 					);
 
-				size_t get_token_position(void);
+				uint32_t get_token_subtype(void);
+
+				token_table &get_token_table(void);
+
+				token_t get_token_type(void);
 
 				bool has_next_token(void);
 
 				bool has_previous_token(void);
 
-				token &move_next_token(
+				size_t move_next_token(
 					__in bool expect_next = false
 					);
 
-				token &move_previous_token(
+				size_t move_previous_token(
 					__in bool expect_previous = false
 					);
 
@@ -188,21 +192,31 @@ namespace LUNA_NS {
 			protected:
 
 				void add_token(
-					__in const uuid &id
+					__in size_t row
 					);
 
 				void add_token(
-					__in const uuid &id,
+					__in size_t row,
 					__in size_t position
 					);
 
-				uuid create_token(
+				size_t create_token(
 					__in_opt token_t type = TOKEN_BEGIN,
 					__in_opt uint32_t subtype = TOKEN_SUBTYPE_INVALID,
 					__in_opt const std::string &text = std::string(),
-					__in_opt const std::string &source = std::string(),
-					__in_opt size_t line = 0,
-					__in_opt double value = 0
+					__in_opt size_t line = TOKEN_LINE_INVALID,
+					__in_opt double value = 0,
+					__in_opt atom_t atom = ATOM_INVALID
+					);
+
+				size_t create_token_slice(
+					__in token_t type,
+					__in uint32_t subtype,
+					__in size_t offset,
+					__in size_t length,
+					__in_opt size_t line = TOKEN_LINE_INVALID,
+					__in_opt double value = 0,
+					__in_opt atom_t atom = ATOM_INVALID
 					);
 
 				void enumerate_alpha_token(void);
@@ -233,6 +247,8 @@ namespace LUNA_NS {
 				void enumerate_literal_string_token(
 					__inout token_t &type,
 					__inout std::string &text,
+					__inout size_t &offset,
+					__inout size_t &length,
 					__in size_t line
 					);
 
@@ -245,14 +261,28 @@ namespace LUNA_NS {
 
 				void enumerate_token(void);
 
-				token_factory_ptr get_token_factory(void);
+				atom_t generate_atom(
+					__in const std::string &text
+					);
+
+				atom_factory_ptr get_atom_factory(void);
+
+				void load(
+					__in image_reader &reader
+					);
+
+				void save(
+					__in image_writer &writer
+					);
 
 				void skip_whitespace(void);
 
-				std::vector<uuid> m_token_list;
+				std::vector<size_t> m_token_list;
 
 				size_t m_token_position;
 
+				token_table m_token_table;
+
 			private:
 
 				std::recursive_mutex m_lock;
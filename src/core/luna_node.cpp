@@ -40,11 +40,11 @@ namespace LUNA_NS {
 		}
 
 		_node::_node(
-			__in const uuid &token_id,
+			__in size_t token,
 			__in_opt size_t parent
 			) :
 				m_parent(parent),
-				m_token_id(token_id)
+				m_token(token)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -56,7 +56,7 @@ namespace LUNA_NS {
 				uuid_base(other),
 				m_child(other.m_child),
 				m_parent(other.m_parent),
-				m_token_id(other.m_token_id)
+				m_token(other.m_token)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -80,7 +80,7 @@ namespace LUNA_NS {
 				uuid_base::operator=(other);
 				m_child = other.m_child;
 				m_parent = other.m_parent;
-				m_token_id = other.m_token_id;
+				m_token = other.m_token;
 			}
 
 			TRACE_EXIT("Return Value: 0x%p", this);
@@ -108,7 +108,7 @@ namespace LUNA_NS {
 
 			m_child.clear();
 			m_parent = PARENT_NODE_NONE;
-			m_token_id.clear();
+			m_token = HANDLE_INVALID;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -157,13 +157,13 @@ namespace LUNA_NS {
 			return m_parent;
 		}
 
-		uuid & 
-		_node::get_token_id(void)
+		size_t 
+		_node::get_token(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return m_token_id;
+			TRACE_EXIT("Return Value: %lu", m_token);
+			return m_token;
 		}
 
 		void 
@@ -268,14 +268,14 @@ namespace LUNA_NS {
 		}
 
 		void 
-		_node::set_token_id(
-			__in const uuid &token_id
+		_node::set_token(
+			__in size_t token
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_token_id = token_id;
+			m_token = token;
 			
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -295,7 +295,7 @@ namespace LUNA_NS {
 				result << uuid_base::to_string(verbose) << " ";
 			}
 
-			result << "Token: " << m_token_id.to_string() << ", Parent: ";
+			result << "Token: " << m_token << ", Parent: ";
 
 			if(m_parent == PARENT_NODE_NONE) {
 				result << NONE;
@@ -343,271 +343,1246 @@ namespace LUNA_NS {
 			return result.str();
 		}
 
-		_node_factory::_node_factory(
-			__in_opt generic_cb_t dest
-			)
+		static const std::string NODE_LAYOUT_STR[] = {
+			"BREADTH", "PREORDER",
+			};
+
+		#define NODE_LAYOUT_STRING(_TYPE_)\
+			((_TYPE_) > NODE_LAYOUT_MAX ? UNKNOWN : NODE_LAYOUT_STR[_TYPE_].c_str())
+
+		_node_arena::_node_arena(void) :
+			m_layout(NODE_LAYOUT_BREADTH),
+			m_tree_base(0)
 		{
 			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
 
-			if(dest) {
-				std::atexit(dest);
-			} else {
-				std::atexit(node_factory_destroy);
-			}
+		_node_arena::_node_arena(
+			__in const _node_arena &other
+			) :
+				m_layout(other.m_layout),
+				m_node(other.m_node),
+				m_shared_map(other.m_shared_map),
+				m_tree_base(0)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
 
+		_node_arena::~_node_arena(void)
+		{
+			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		_node_factory::~_node_factory(void)
+		_node_arena &
+		_node_arena::operator=(
+			__in const _node_arena &other
+			)
 		{
 			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 
-			destroy();
+			if(this != &other) {
+				m_layout = other.m_layout;
+				m_node = other.m_node;
+				m_shared_map = other.m_shared_map;
+			}
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			TRACE_EXIT("Return Value: 0x%p", this);
+			return *this;
 		}
 
-		_node_factory *
-		_node_factory::acquire(
-			__in_opt generic_cb_t dest
+		size_t 
+		_node_arena::add_tree(
+			__in const node_list_t &tree
 			)
 		{
-			node_factory_ptr result;
+			uint32_t parent;
+			size_t count, iter, result;
 
 			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(!m_instance) {
-			
-				m_instance = new node_factory(dest);
-				if(!m_instance) {
-					THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_ALLOC_FAILED);
+			count = tree.size();
+			if(!count || (tree.front().parent != NODE_RECORD_NONE)) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_TREE,
+					"cnt: %lu", count);
+			}
+
+			for(iter = 1; iter < count; ++iter) {
+				parent = tree[iter].parent;
+
+				if(parent >= iter) {
+					THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_TREE,
+						"pos/par: %lu/%lu", iter, parent);
 				}
 			}
 
-			result = m_instance;
+			result = m_node.size();
+			m_node.resize(result + count);
+			commit_tree(tree, result);
+			m_tree_base = result;
 
-			TRACE_EXIT("Return Value: 0x%p", result);
+			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
 		void 
-		_node_factory::add_node(
-			__in const uuid &id,
-			__in const node &nd
+		_node_arena::add_shared(
+			__in uint64_t hash,
+			__in size_t index
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
-			}
+			get_node(index);
 
-			if(m_node_map.find(id) != m_node_map.end()) {
-				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_ID_ALREADY_ADDED,
-					"%s", uuid::id_as_string(id).c_str());
+			if(m_shared_map.find(hash) == m_shared_map.end()) {
+				m_shared_map.insert(std::pair<uint64_t, uint32_t>(hash, index));
 			}
 
-			m_node_map.insert(std::pair<uuid, node>(id, nd));
-
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_node_factory::clear(void)
+		_node_arena::clear(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
-			}
 
-			m_node_map.clear();
+			m_child_list.clear();
+			m_child_offset.clear();
+			m_node.clear();
+			m_order.clear();
+			m_remap.clear();
+			m_scratch.clear();
+			m_shared_map.clear();
+			m_tree_base = 0;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_node_factory::destroy(void)
+		_node_arena::commit_tree(
+			__in const node_list_t &tree,
+			__in size_t base
+			)
 		{
+			uint32_t child, parent;
+			size_t count, iter, position;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(m_initialized) {
-				clear();
-				m_initialized = false;
+			count = tree.size();
+			m_child_offset.assign(count + 1, 0);
+			m_child_list.resize(count);
+
+			for(iter = 1; iter < count; ++iter) {
+				++m_child_offset[tree[iter].parent + 1];
+			}
+
+			for(iter = 1; iter <= count; ++iter) {
+				m_child_offset[iter] += m_child_offset[iter - 1];
+			}
+
+			m_remap.assign(m_child_offset.begin(), m_child_offset.end() - 1);
+
+			for(iter = 1; iter < count; ++iter) {
+				m_child_list[m_remap[tree[iter].parent]++] = iter;
+			}
+
+			m_order.clear();
+
+			switch(m_layout) {
+				case NODE_LAYOUT_PREORDER:
+					m_remap.assign(1, 0);
+
+					while(!m_remap.empty()) {
+						parent = m_remap.back();
+						m_remap.pop_back();
+						m_order.push_back(parent);
+
+						for(child = m_child_offset[parent + 1]; child > m_child_offset[parent]; --child) {
+							m_remap.push_back(m_child_list[child - 1]);
+						}
+					}
+					break;
+				default:
+					m_order.push_back(0);
+
+					for(position = 0; position < m_order.size(); ++position) {
+						parent = m_order[position];
+
+						for(child = m_child_offset[parent]; child < m_child_offset[parent + 1]; ++child) {
+							m_order.push_back(m_child_list[child]);
+						}
+					}
+					break;
+			}
+
+			m_remap.resize(count);
+
+			for(position = 0; position < count; ++position) {
+				m_remap[m_order[position]] = position;
+			}
+
+			for(position = 0; position < count; ++position) {
+				const node_rec_t &src = tree[m_order[position]];
+				node_rec_t &dst = m_node[base + position];
+
+				parent = m_order[position];
+				dst.token = src.token;
+				dst.parent = (src.parent == NODE_RECORD_NONE) ? NODE_RECORD_NONE 
+					: (base + m_remap[src.parent]);
+				dst.skip = 1;
+
+				if(src.first != NODE_RECORD_NONE) {
+					dst.count = src.count;
+					dst.first = src.first;
+				} else {
+					dst.count = m_child_offset[parent + 1] - m_child_offset[parent];
+					dst.first = dst.count ? (base + m_remap[m_child_list[m_child_offset[parent]]]) 
+						: NODE_RECORD_NONE;
+				}
+			}
+
+			for(position = count - 1; position > 0; --position) {
+				node_rec_t &dst = m_node[base + position];
+				m_node[dst.parent].skip += dst.skip;
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		std::map<uuid, node>::iterator 
-		_node_factory::find_node(
-			__in const uuid &id
+		size_t 
+		_node_arena::find_shared(
+			__in uint64_t hash
 			)
 		{
-			std::map<uuid, node>::iterator result;
+			size_t result = NODE_RECORD_NONE;
+			std::unordered_map<uint64_t, uint32_t>::iterator shared_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
-			}
 
-			result = m_node_map.find(id);
-			if(result == m_node_map.end()) {
-				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_ID_NOT_FOUND,
-					"%s", uuid::id_as_string(id).c_str());
+			shared_iter = m_shared_map.find(hash);
+			if(shared_iter != m_shared_map.end()) {
+				result = shared_iter->second;
 			}
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
-		node &
-		_node_factory::generate(
-			__in const uuid &token_id,
-			__in_opt size_t parent
+		size_t 
+		_node_arena::get_child(
+			__in size_t index,
+			__in size_t position
 			)
 		{
-			node nd(token_id);
+			size_t iter, result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+
+			node_rec_t &nd = get_node(index);
+			if(position >= nd.count) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_NODE_POSITION,
+					"pos/cnt: %lu/%lu", position, nd.count);
 			}
 
-			nd.set_parent(parent);
-			add_node(nd.get_id(), nd);
+			result = nd.first;
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_node(nd.get_id())->second;
+			switch(m_layout) {
+				case NODE_LAYOUT_PREORDER:
+
+					for(iter = 0; iter < position; ++iter) {
+						result += m_node[result].skip;
+					}
+					break;
+				default:
+					result += position;
+					break;
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
 		}
 
-		node &
-		_node_factory::get_node(
-			__in const uuid &id
+		node_layout_t 
+		_node_arena::get_layout(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %s", NODE_LAYOUT_STRING(m_layout));
+			return m_layout;
+		}
+
+		node_rec_t &
+		_node_arena::get_node(
+			__in size_t index
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+
+			if(index >= m_node.size()) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_NODE_POSITION,
+					"pos/max: %lu/%lu", index, m_node.size());
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_node(id)->second;
+			return m_node[index];
 		}
 
-		bool 
-		_node_factory::has_node(
-			__in const uuid &id
+		size_t 
+		_node_arena::get_sibling(
+			__in size_t index
 			)
 		{
-			bool result;
+			size_t result = NODE_RECORD_NONE;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+
+			node_rec_t &nd = get_node(index);
+			if(nd.parent != NODE_RECORD_NONE) {
+				node_rec_t &par = m_node[nd.parent];
+
+				switch(m_layout) {
+					case NODE_LAYOUT_PREORDER:
+
+						if((index + nd.skip) < (nd.parent + par.skip)) {
+							result = index + nd.skip;
+						}
+						break;
+					default:
+
+						if((index + 1) < (par.first + par.count)) {
+							result = index + 1;
+						}
+						break;
+				}
 			}
 
-			result = (m_node_map.find(id) != m_node_map.end());
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
 
-			TRACE_EXIT("Return Value: 0x%x", result);
+		size_t 
+		_node_arena::get_tree_position(
+			__in size_t position
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(position >= m_remap.size()) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_NODE_POSITION,
+					"pos/max: %lu/%lu", position, m_remap.size());
+			}
+
+			result = m_tree_base + m_remap[position];
+
+			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
-		void 
-		_node_factory::initialize(void)
+		bool 
+		_node_arena::is_leaf(
+			__in size_t index
+			)
 		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			destroy();
-			m_initialized = true;
+			result = !get_node(index).count;
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		bool 
-		_node_factory::is_initialized(void)
+		_node_arena::is_link(
+			__in size_t index
+			)
 		{
 			bool result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = m_initialized;
+			node_rec_t &nd = get_node(index);
+			result = (nd.count && (m_node[nd.first].parent != index));
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
-		void 
-		_node_factory::remove_node(
-			__in const uuid &id
+		bool 
+		_node_arena::is_root(
+			__in size_t index
 			)
 		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
-			}
 
-			m_node_map.erase(find_node(id));
+			result = (get_node(index).parent == NODE_RECORD_NONE);
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		size_t 
-		_node_factory::size(void)
+		_node_arena::load(
+			__in image_reader &reader,
+			__in size_t token_count
+			)
 		{
-			size_t result;
+			const void *data;
+			size_t child, count, iter, position, result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+
+			set_layout((node_layout_t) reader.read_value());
+			count = reader.read_value();
+			data = reader.read_array(count, sizeof(node_rec_t));
+
+			result = m_node.size();
+			m_node.resize(result + count);
+			if(count) {
+				std::memcpy(&m_node[result], data, count * sizeof(node_rec_t));
 			}
 
-			result = m_node_map.size();
+			for(iter = 0; iter < count; ++iter) {
+				const node_rec_t &nd = m_node[result + iter];
+
+				if((nd.token >= token_count)
+						|| ((nd.parent != NODE_RECORD_NONE) && (nd.parent >= count))
+						|| ((nd.first != NODE_RECORD_NONE) && (nd.first >= count))
+						|| (nd.count && ((nd.first == NODE_RECORD_NONE) 
+							|| (((size_t) nd.first + nd.count) > count)))
+						|| !nd.skip || (nd.skip > (count - iter))) {
+					m_node.resize(result);
+					THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_TREE,
+						"pos/cnt: %lu/%lu", iter, count);
+				}
 
-			TRACE_EXIT("Return Value: 0x%x", result);
+				if(m_layout == NODE_LAYOUT_PREORDER) {
+
+					for(child = nd.first, position = 0; position < nd.count; ++position) {
+
+						if(child >= count) {
+							m_node.resize(result);
+							THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_TREE,
+								"pos/cnt: %lu/%lu", iter, count);
+						}
+
+						child += m_node[result + child].skip;
+					}
+				}
+			}
+
+			for(iter = result; iter < m_node.size(); ++iter) {
+				node_rec_t &nd = m_node[iter];
+
+				if(nd.parent != NODE_RECORD_NONE) {
+					nd.parent += result;
+				}
+
+				if(nd.first != NODE_RECORD_NONE) {
+					nd.first += result;
+				}
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
-		std::string 
-		_node_factory::to_string(
-			__in bool verbose
+		void 
+		_node_arena::reserve(
+			__in size_t count
 			)
 		{
-			std::stringstream result;
-			std::map<uuid, node>::iterator node_iter;
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_node.reserve(count);
 
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_node_arena::save(
+			__in image_writer &writer
+			)
+		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(!m_initialized) {
-				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			writer.write_value(m_layout);
+			writer.write_list(m_node);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_node_arena::set_layout(
+			__in node_layout_t layout
+			)
+		{
+			size_t base, count, iter;
+			std::vector<uint32_t>::iterator link_iter;
+			std::unordered_map<uint64_t, uint32_t>::iterator shared_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(layout > NODE_LAYOUT_MAX) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_INVALID_LAYOUT,
+					"%lu", layout);
 			}
 
-			if(verbose) {
-				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
+			if(layout != m_layout) {
+				m_layout = layout;
+				m_link_list.clear();
+				m_relayout.resize(m_node.size());
+
+				for(base = 0; base < m_node.size(); base += count) {
+					count = m_node[base].skip;
+					m_scratch.resize(count);
+
+					for(iter = 0; iter < count; ++iter) {
+						node_rec_t &src = m_node[base + iter];
+
+						m_scratch[iter].token = src.token;
+						m_scratch[iter].parent = (src.parent == NODE_RECORD_NONE) ? NODE_RECORD_NONE 
+							: (src.parent - base);
+						m_scratch[iter].first = NODE_RECORD_NONE;
+						m_scratch[iter].count = 0;
+
+						if(is_link(base + iter)) {
+							m_scratch[iter].first = src.first;
+							m_scratch[iter].count = src.count;
+						}
+					}
+
+					commit_tree(m_scratch, base);
+
+					for(iter = 0; iter < count; ++iter) {
+						m_relayout[base + m_order[iter]] = base + iter;
+
+						if(m_scratch[m_order[iter]].first != NODE_RECORD_NONE) {
+							m_link_list.push_back(base + iter);
+						}
+					}
+				}
+
+				for(link_iter = m_link_list.begin(); link_iter != m_link_list.end(); ++link_iter) {
+					m_node[*link_iter].first = m_relayout[m_node[*link_iter].first];
+				}
+
+				for(shared_iter = m_shared_map.begin(); shared_iter != m_shared_map.end(); ++shared_iter) {
+					shared_iter->second = m_relayout[shared_iter->second];
+				}
 			}
 
-			result << "Entries: " << m_node_map.size();
-			
-			for(node_iter = m_node_map.begin(); node_iter != m_node_map.end(); ++node_iter) {
-				result << std::endl << node_iter->second.to_string(verbose);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_node_arena::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_node.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_node_arena::to_string(
+			__in_opt bool verbose
+			)
+		{
+			size_t iter;
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Layout: " << NODE_LAYOUT_STRING(m_layout) << ", Entries: " << m_node.size() 
+				<< ", Bytes: " << (m_node.size() * sizeof(node_rec_t)) << ", Shared: " << m_shared_map.size();
+
+			if(verbose) {
+
+				for(iter = 0; iter < m_node.size(); ++iter) {
+					result << std::endl << "{" << iter << "} Token: " << m_node[iter].token << ", Parent: ";
+
+					if(m_node[iter].parent == NODE_RECORD_NONE) {
+						result << NONE;
+					} else {
+						result << m_node[iter].parent;
+					}
+
+					result << ", Children[" << m_node[iter].count << "]";
+
+					if(m_node[iter].count) {
+						result << " {" << m_node[iter].first << "}";
+
+						if(m_node[m_node[iter].first].parent != iter) {
+							result << " (LINK)";
+						}
+					}
+
+					result << ", Skip: " << m_node[iter].skip;
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		_node_iterator::_node_iterator(
+			__in node_arena_ptr arena,
+			__in size_t root
+			) :
+				m_arena(arena),
+				m_depth(0),
+				m_position(root),
+				m_root(root)
+		{
+			TRACE_ENTRY();
+
+			if(!m_arena) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_ALLOC_FAILED);
+			}
+
+			m_arena->get_node(m_root);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_node_iterator::_node_iterator(
+			__in const _node_iterator &other
+			) :
+				m_arena(other.m_arena),
+				m_depth(other.m_depth),
+				m_link(other.m_link),
+				m_position(other.m_position),
+				m_root(other.m_root)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_node_iterator::~_node_iterator(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_node_iterator &
+		_node_iterator::operator=(
+			__in const _node_iterator &other
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(this != &other) {
+				m_arena = other.m_arena;
+				m_depth = other.m_depth;
+				m_link = other.m_link;
+				m_position = other.m_position;
+				m_root = other.m_root;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", this);
+			return *this;
+		}
+
+		size_t 
+		_node_iterator::find_next(
+			__in bool skip_children,
+			__out size_t &depth,
+			__inout std::vector<size_t> &link
+			)
+		{
+			size_t parent, result = m_position;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			depth = m_depth;
+
+			if(!skip_children && !m_arena->is_leaf(result)) {
+
+				if(m_arena->is_link(result)) {
+					link.push_back(result);
+				}
+
+				result = m_arena->get_node(result).first;
+				++depth;
+			} else {
+
+				for(;;) {
+
+					if(result == m_root) {
+						result = NODE_RECORD_NONE;
+						break;
+					}
+
+					size_t sibling = m_arena->get_sibling(result);
+					if(sibling != NODE_RECORD_NONE) {
+						result = sibling;
+						break;
+					}
+
+					parent = m_arena->get_node(result).parent;
+					if(!link.empty() 
+							&& (m_arena->get_node(m_arena->get_node(link.back()).first).parent == parent)) {
+						parent = link.back();
+						link.pop_back();
+					}
+
+					result = parent;
+					--depth;
+				}
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_node_iterator::get_depth(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %lu", m_depth);
+			return m_depth;
+		}
+
+		node_rec_t &
+		_node_iterator::get_node(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return m_arena->get_node(m_position);
+		}
+
+		size_t 
+		_node_iterator::get_position(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %lu", m_position);
+			return m_position;
+		}
+
+		bool 
+		_node_iterator::has_next(
+			__in_opt bool skip_children
+			)
+		{
+			bool result;
+			size_t depth;
+			std::vector<size_t> link;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			link = m_link;
+			result = (find_next(skip_children, depth, link) != NODE_RECORD_NONE);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		size_t 
+		_node_iterator::move_next(
+			__in_opt bool skip_children
+			)
+		{
+			size_t depth, result;
+			std::vector<size_t> link;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			link = m_link;
+			result = find_next(skip_children, depth, link);
+			if(result == NODE_RECORD_NONE) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_NO_NEXT_NODE,
+					"pos/root: %lu/%lu", m_position, m_root);
+			}
+
+			m_depth = depth;
+			m_link.swap(link);
+			m_position = result;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_node_iterator::reset(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_depth = 0;
+			m_link.clear();
+			m_position = m_root;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		std::string 
+		_node_iterator::to_string(void)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Root: " << m_root << ", Position: " << m_position << ", Depth: " << m_depth;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		_node_factory::_node_factory(void) :
+			m_id_mapping(HANDLE_ID_MAPPING_DEFAULT),
+			m_initialized(false)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_node_factory::~_node_factory(void)
+		{
+			TRACE_ENTRY();
+
+			destroy();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_node_factory *
+		_node_factory::acquire(
+			__in_opt generic_cb_t dest
+			)
+		{
+			node_factory_ptr result;
+
+			TRACE_ENTRY();
+
+			if(!m_instance) {
+				
+				m_instance = new node_factory;
+				if(!m_instance) {
+					THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_ALLOC_FAILED);
+				}
+
+				if(dest) {
+					std::atexit(dest);
+				} else {
+					std::atexit(node_factory_destroy);
+				}
+			}
+
+			result = m_instance;
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		handle_t 
+		_node_factory::add_node(
+			__in const uuid &id,
+			__in const node &nd
+			)
+		{
+			uint32_t slot;
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(m_id_mapping && (m_id_map.find(id) != m_id_map.end())) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_ID_ALREADY_ADDED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = m_handle_table.allocate();
+			slot = HANDLE_SLOT(result);
+
+			if(slot >= m_node_list.size()) {
+				m_node_list.resize(slot + 1, NULL);
+			}
+
+			m_node_list.at(slot) = new node(nd);
+			if(!m_node_list.at(slot)) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_ALLOC_FAILED);
+			}
+
+			if(m_id_mapping) {
+				m_id_map.insert(std::pair<uuid, handle_t>(id, result));
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		void 
+		_node_factory::clear(void)
+		{
+			std::vector<node_ptr>::iterator nd_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			for(nd_iter = m_node_list.begin(); nd_iter != m_node_list.end(); ++nd_iter) {
+
+				if(*nd_iter) {
+					delete *nd_iter;
+				}
+			}
+
+			m_node_list.clear();
+			m_handle_table.clear();
+			m_id_map.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_node_factory::destroy(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized) {
+				clear();
+				m_initialized = false;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		std::unordered_map<uuid, handle_t>::iterator 
+		_node_factory::find_handle(
+			__in const uuid &id
+			)
+		{
+			std::unordered_map<uuid, handle_t>::iterator result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!m_id_mapping) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_ID_UNMAPPED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = m_id_map.find(id);
+			if(result == m_id_map.end()) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_ID_NOT_FOUND,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result;
+		}
+
+		node_ptr 
+		_node_factory::find_node(
+			__in handle_t handle
+			)
+		{
+			node_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_node_list[m_handle_table.get_slot(handle)];
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		handle_t 
+		_node_factory::generate(
+			__in size_t token,
+			__in_opt size_t parent
+			)
+		{
+			node nd(token);
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			nd.set_parent(parent);
+			result = add_node(nd.get_id(), nd);
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		handle_t 
+		_node_factory::get_handle(
+			__in const uuid &id
+			)
+		{
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = find_handle(id)->second;
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		node &
+		_node_factory::get_node(
+			__in handle_t handle
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return *find_node(handle);
+		}
+
+		node &
+		_node_factory::get_node(
+			__in const uuid &id
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return *find_node(find_handle(id)->second);
+		}
+
+		bool 
+		_node_factory::has_node(
+			__in handle_t handle
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_handle_table.is_valid(handle);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_node_factory::has_node(
+			__in const uuid &id
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!m_id_mapping) {
+				THROW_LUNA_NODE_EXCEPTION_MESSAGE(LUNA_NODE_EXCEPTION_ID_UNMAPPED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = (m_id_map.find(id) != m_id_map.end());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_node_factory::initialize(
+			__in_opt bool id_mapping
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			destroy();
+			m_id_mapping = id_mapping;
+			m_initialized = true;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		bool 
+		_node_factory::is_id_mapped(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_id_mapping;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_node_factory::is_initialized(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_initialized;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_node_factory::remove_node(
+			__in handle_t handle
+			)
+		{
+			uint32_t slot;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			slot = m_handle_table.get_slot(handle);
+
+			if(m_id_mapping) {
+				m_id_map.erase(m_node_list.at(slot)->get_id());
+			}
+
+			delete m_node_list.at(slot);
+			m_node_list.at(slot) = NULL;
+			m_handle_table.release(handle);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_node_factory::remove_node(
+			__in const uuid &id
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			remove_node(find_handle(id)->second);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_node_factory::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_handle_table.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_node_factory::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+			std::vector<node_ptr>::iterator nd_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_NODE_EXCEPTION(LUNA_NODE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(verbose) {
+				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
+			}
+
+			result << "Entries: " << m_handle_table.size();
+
+			if(verbose) {
+				result << ", " << m_handle_table.to_string(verbose) << ", UUID mapping: " 
+					<< (m_id_mapping ? "on" : "off");
+			}
+			
+			for(nd_iter = m_node_list.begin(); nd_iter != m_node_list.end(); ++nd_iter) {
+
+				if(*nd_iter) {
+					result << std::endl << (*nd_iter)->to_string(verbose);
+				}
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
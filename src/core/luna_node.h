@@ -20,21 +20,40 @@
 #ifndef LUNA_NODE_H_
 #define LUNA_NODE_H_
 
+#include <unordered_map>
 #include <vector>
 
 namespace LUNA_NS {
 
 	namespace LUNA_COMP_NS {
 
+		#define NODE_RECORD_NONE ((uint32_t) INVALID)
 		#define PARENT_NODE_NONE ((size_t) INVALID)
 
+		typedef enum {
+			NODE_LAYOUT_BREADTH = 0,
+			NODE_LAYOUT_PREORDER,
+		} node_layout_t;
+
+		#define NODE_LAYOUT_MAX NODE_LAYOUT_PREORDER
+
+		typedef struct {
+			uint32_t token;
+			uint32_t parent;
+			uint32_t first;
+			uint32_t count;
+			uint32_t skip;
+		} node_rec_t, *node_rec_ptr_t;
+
+		typedef std::vector<node_rec_t> node_list_t, *node_list_ptr_t;
+
 		typedef class _node :
 				public uuid_base {
 		
 			public:
 
 				_node(
-					__in const uuid &token_id,
+					__in size_t token,
 					__in_opt size_t parent = PARENT_NODE_NONE
 					);
 
@@ -62,7 +81,7 @@ namespace LUNA_NS {
 
 				size_t get_parent(void);
 
-				uuid &get_token_id(void);
+				size_t get_token(void);
 
 				void insert_child(
 					__in size_t position,
@@ -86,8 +105,8 @@ namespace LUNA_NS {
 					__in size_t offset
 					);
 
-				void set_token_id(
-					__in const uuid &token_id
+				void set_token(
+					__in size_t token
 					);
 
 				virtual std::string to_string(
@@ -100,7 +119,7 @@ namespace LUNA_NS {
 
 				size_t m_parent;
 
-				uuid m_token_id;
+				size_t m_token;
 
 			private:
 
@@ -108,6 +127,187 @@ namespace LUNA_NS {
 
 		} node, *node_ptr;
 
+		typedef class _node_arena {
+
+			public:
+
+				_node_arena(void);
+
+				_node_arena(
+					__in const _node_arena &other
+					);
+
+				virtual ~_node_arena(void);
+
+				_node_arena &operator=(
+					__in const _node_arena &other
+					);
+
+				void add_shared(
+					__in uint64_t hash,
+					__in size_t index
+					);
+
+				size_t add_tree(
+					__in const node_list_t &tree
+					);
+
+				void clear(void);
+
+				size_t find_shared(
+					__in uint64_t hash
+					);
+
+				size_t get_child(
+					__in size_t index,
+					__in size_t position
+					);
+
+				node_layout_t get_layout(void);
+
+				node_rec_t &get_node(
+					__in size_t index
+					);
+
+				size_t get_sibling(
+					__in size_t index
+					);
+
+				size_t get_tree_position(
+					__in size_t position
+					);
+
+				bool is_leaf(
+					__in size_t index
+					);
+
+				bool is_link(
+					__in size_t index
+					);
+
+				bool is_root(
+					__in size_t index
+					);
+
+				size_t load(
+					__in image_reader &reader,
+					__in size_t token_count
+					);
+
+				void reserve(
+					__in size_t count
+					);
+
+				void save(
+					__in image_writer &writer
+					);
+
+				void set_layout(
+					__in node_layout_t layout
+					);
+
+				size_t size(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				void commit_tree(
+					__in const node_list_t &tree,
+					__in size_t base
+					);
+
+				std::vector<uint32_t> m_child_list;
+
+				std::vector<uint32_t> m_child_offset;
+
+				node_layout_t m_layout;
+
+				std::vector<uint32_t> m_link_list;
+
+				std::vector<node_rec_t> m_node;
+
+				std::vector<uint32_t> m_order;
+
+				std::vector<uint32_t> m_relayout;
+
+				std::vector<uint32_t> m_remap;
+
+				node_list_t m_scratch;
+
+				std::unordered_map<uint64_t, uint32_t> m_shared_map;
+
+				size_t m_tree_base;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} node_arena, *node_arena_ptr;
+
+		typedef class _node_iterator {
+
+			public:
+
+				_node_iterator(
+					__in node_arena_ptr arena,
+					__in size_t root
+					);
+
+				_node_iterator(
+					__in const _node_iterator &other
+					);
+
+				virtual ~_node_iterator(void);
+
+				_node_iterator &operator=(
+					__in const _node_iterator &other
+					);
+
+				size_t get_depth(void);
+
+				node_rec_t &get_node(void);
+
+				size_t get_position(void);
+
+				bool has_next(
+					__in_opt bool skip_children = false
+					);
+
+				size_t move_next(
+					__in_opt bool skip_children = false
+					);
+
+				void reset(void);
+
+				std::string to_string(void);
+
+			protected:
+
+				size_t find_next(
+					__in bool skip_children,
+					__out size_t &depth,
+					__inout std::vector<size_t> &link
+					);
+
+				node_arena_ptr m_arena;
+
+				size_t m_depth;
+
+				std::vector<size_t> m_link;
+
+				size_t m_position;
+
+				size_t m_root;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} node_iterator, *node_iterator_ptr;
+
 		void node_factory_destroy(void);
 
 		typedef class _node_factory {
@@ -118,7 +318,7 @@ namespace LUNA_NS {
 					__in_opt generic_cb_t dest = NULL
 					);
 
-				void add_node(
+				handle_t add_node(
 					__in const uuid &id,
 					__in const node &nd
 					);
@@ -127,23 +327,43 @@ namespace LUNA_NS {
 
 				void destroy(void);
 
-				node &generate(
-					__in const uuid &token_id,
+				handle_t generate(
+					__in size_t token,
 					__in_opt size_t parent = PARENT_NODE_NONE
 					);
 
+				handle_t get_handle(
+					__in const uuid &id
+					);
+
+				node &get_node(
+					__in handle_t handle
+					);
+
 				node &get_node(
 					__in const uuid &id
 					);
 
+				bool has_node(
+					__in handle_t handle
+					);
+
 				bool has_node(
 					__in const uuid &id
 					);
 
-				void initialize(void);
+				void initialize(
+					__in_opt bool id_mapping = HANDLE_ID_MAPPING_DEFAULT
+					);
+
+				bool is_id_mapped(void);
 
 				bool is_initialized(void);
 
+				void remove_node(
+					__in handle_t handle
+					);
+
 				void remove_node(
 					__in const uuid &id
 					);
@@ -156,11 +376,11 @@ namespace LUNA_NS {
 
 			protected:
 
+				friend class _context;
+
 				friend void node_factory_destroy(void);
 
-				_node_factory(
-					__in_opt generic_cb_t dest = NULL
-					);
+				_node_factory(void);
 
 				_node_factory(
 					__in const _node_factory &other
@@ -172,15 +392,25 @@ namespace LUNA_NS {
 					__in const _node_factory &other
 					);
 
-				std::map<uuid, node>::iterator find_node(
+				std::unordered_map<uuid, handle_t>::iterator find_handle(
 					__in const uuid &id
 					);
 
+				node_ptr find_node(
+					__in handle_t handle
+					);
+
+				handle_table m_handle_table;
+
+				bool m_id_mapping;
+
+				std::unordered_map<uuid, handle_t> m_id_map;
+
 				bool m_initialized;
 
 				static _node_factory *m_instance;
 
-				std::map<uuid, node> m_node_map;
+				std::vector<node_ptr> m_node_list;
 
 			private:
 
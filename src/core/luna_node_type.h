@@ -28,7 +28,11 @@ namespace LUNA_NS {
 			LUNA_NODE_EXCEPTION_ALLOC_FAILED = 0,
 			LUNA_NODE_EXCEPTION_ID_ALREADY_ADDED,
 			LUNA_NODE_EXCEPTION_ID_NOT_FOUND,
+			LUNA_NODE_EXCEPTION_ID_UNMAPPED,
 			LUNA_NODE_EXCEPTION_INVALID_NODE_POSITION,
+			LUNA_NODE_EXCEPTION_INVALID_LAYOUT,
+			LUNA_NODE_EXCEPTION_INVALID_TREE,
+			LUNA_NODE_EXCEPTION_NO_NEXT_NODE,
 			LUNA_NODE_EXCEPTION_UNINITIALIZED,
 		};
 
@@ -36,7 +40,11 @@ namespace LUNA_NS {
 			"Node factory allocation failed",
 			"Node UUID was already added",
 			"Node UUID was not found",
+			"Node UUID mapping is disabled",
 			"Invalid node position",
+			"Invalid node layout",
+			"Invalid node tree",
+			"No next node",
 			"Node factory is uninitialized",
 			};
 
@@ -52,6 +60,12 @@ namespace LUNA_NS {
 		class _node;
 		typedef _node node, *node_ptr;
 
+		class _node_arena;
+		typedef _node_arena node_arena, *node_arena_ptr;
+
+		class _node_iterator;
+		typedef _node_iterator node_iterator, *node_iterator_ptr;
+
 		class _node_factory;
 		typedef _node_factory node_factory, *node_factory_ptr;
 	}
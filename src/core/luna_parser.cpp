@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
 #include <queue>
 #include "luna.h"
 #include "luna_parser_type.h"
@@ -25,9 +26,26 @@ namespace LUNA_NS {
 
 	namespace LUNA_LANG_NS {
 	
+		#define HASH_CONS_PRIME 0x100000001b3ULL
+		#define HASH_CONS_SEED 0xcbf29ce484222325ULL
+		#define HASH_CONS_MIX(_HASH_, _VALUE_) (((_HASH_) ^ ((uint64_t) (_VALUE_))) * HASH_CONS_PRIME)
+
+		#define HASH_CONS_TOKEN_BYTES (sizeof(atom_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t)\
+			+ sizeof(uint32_t) + sizeof(uint8_t) + sizeof(double))
+
 		#define NODE_TAB_SEQUENCE "---"
 
+		enum {
+			SHARE_STATE_ELIGIBLE = 0,
+			SHARE_STATE_INELIGIBLE,
+			SHARE_STATE_KEEP,
+			SHARE_STATE_LINK,
+			SHARE_STATE_DROP,
+		};
+
 		_parser::_parser(void) :
+			m_context(new context),
+			m_hash_consing(false),
 			m_statement_position(0)
 		{
 			TRACE_ENTRY();
@@ -40,7 +58,10 @@ namespace LUNA_NS {
 		_parser::_parser(
 			__in const std::string &input,
 			__in_opt bool is_file
-			)
+			) :
+				m_context(new context),
+				m_hash_consing(false),
+				m_statement_position(0)
 		{
 			TRACE_ENTRY();
 
@@ -53,7 +74,10 @@ namespace LUNA_NS {
 			__in const _parser &other
 			) :
 				lexer(other),
-				m_control_token_list(other.m_control_token_list),
+				m_context(new context(*other.m_context)),
+				m_control_token_map(other.m_control_token_map),
+				m_hash_consing(other.m_hash_consing),
+				m_hash_cons_stats(other.m_hash_cons_stats),
 				m_statement_list(other.m_statement_list),
 				m_statement_position(other.m_statement_position)
 		{
@@ -81,7 +105,10 @@ namespace LUNA_NS {
 			if(this != &other) {
 				lexer::operator=(other);
 				parser::clear();
-				m_control_token_list = other.m_control_token_list;
+				m_context = context_shared_t(new context(*other.m_context));
+				m_control_token_map = other.m_control_token_map;
+				m_hash_consing = other.m_hash_consing;
+				m_hash_cons_stats = other.m_hash_cons_stats;
 				m_statement_list = other.m_statement_list;
 				m_statement_position = other.m_statement_position;
 			}
@@ -92,13 +119,12 @@ namespace LUNA_NS {
 
 		size_t 
 		_parser::add_child_node(
-			__in statement_t &stmt,
-			__in const uuid &token_id,
+			__in node_list_t &stmt,
+			__in size_t token,
 			__in_opt size_t parent
 			)
 		{
 			size_t result;
-			node_factory_ptr node_fact;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -108,14 +134,9 @@ namespace LUNA_NS {
 					"pos/max: %lu/%lu", parent, (stmt.size() - 1));
 			}
 
-			node_fact = get_node_factory();
-			if(!node_fact) {
-				THROW_LUNA_PARSER_EXCEPTION(LUNA_PARSER_EXCEPTION_FACTORY_ALLOC_FAILED);
-			}
-
 			result = stmt.size();
-			stmt.push_back(create_node(token_id, parent));
-			node_fact->get_node(stmt.at(parent)).add_child(result);
+			stmt.push_back(create_node(token, parent));
+			++stmt.at(parent).count;
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
@@ -123,7 +144,7 @@ namespace LUNA_NS {
 
 		size_t 
 		_parser::add_control_node(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in token_t type,
 			__in_opt size_t parent
 			)
@@ -133,36 +154,19 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_control_token_list.push_back(lexer::create_token(type));
-			result = add_child_node(stmt, m_control_token_list.back(), parent);
+			result = add_child_node(stmt, create_control_token(type), parent);
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
-		statement_t & 
-		_parser::add_control_node(
-			__in token_t type,
-			__in_opt size_t position
-			)
-		{
-			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			m_control_token_list.push_back(lexer::create_token(type));
-			add_root_node(create_node(m_control_token_list.back()), position);
-
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return m_statement_list.at(m_statement_position + 1);
-		}
-
 		void 
-		_parser::add_root_node(
-			__in const uuid &node_id,
+		_parser::add_statement(
+			__in const node_list_t &stmt,
 			__in size_t position
 			)
 		{
-			statement_t stmt;
+			statement_t entry;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -172,12 +176,13 @@ namespace LUNA_NS {
 					"pos/max: %lu/%lu", position, m_statement_list.size());
 			}
 
-			stmt.push_back(node_id);
+			entry.first = get_node_arena()->add_tree(stmt);
+			entry.second = stmt.size();
 
 			if(position < m_statement_list.size()) {
-				m_statement_list.insert(m_statement_list.begin() + position, stmt);
+				m_statement_list.insert(m_statement_list.begin() + position, entry);
 			} else {
-				m_statement_list.push_back(stmt);
+				m_statement_list.push_back(entry);
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -186,73 +191,72 @@ namespace LUNA_NS {
 		void 
 		_parser::clear(void)
 		{
-			node_factory_ptr node_fact;
-			token_factory_ptr tok_fact;
-			std::vector<uuid>::iterator id_iter;
-			std::vector<statement_t>::iterator stmt_iter;
-
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			lexer::reset();
 
-			tok_fact = lexer::get_token_factory();
-			if(tok_fact) {
-				
-				for(id_iter = m_control_token_list.begin(); id_iter != m_control_token_list.end(); ++id_iter) {
-					tok_fact->remove_token(*id_iter);
-				}
-			}
+			m_context->get_node_arena()->clear();
+			std::memset(&m_hash_cons_stats, 0, sizeof(m_hash_cons_stats));
+			m_control_token_map.clear();
+			m_share_pending.clear();
+			m_statement_list.clear();
+			m_statement_scratch.assign(1, create_node(lexer::get_token_row(0)));
+			add_statement(m_statement_scratch, 0);
+			m_statement_scratch.assign(1, create_node(lexer::get_token_row(m_token_list.size() - 1)));
+			add_statement(m_statement_scratch, 1);
+			m_statement_position = 0;
 
-			node_fact = get_node_factory();
-			if(node_fact) {
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
 
-				for(stmt_iter = m_statement_list.begin(); stmt_iter != m_statement_list.end(); ++stmt_iter) {
+		size_t 
+		_parser::create_control_token(
+			__in token_t type
+			)
+		{
+			size_t result;
+			std::map<token_t, size_t>::iterator token_iter;
 
-					for(id_iter = stmt_iter->begin(); id_iter != stmt_iter->end(); ++id_iter) {
-						node_fact->remove_node(*id_iter);
-					}
-				}
-			}
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_statement_list.clear();
+			if(m_hash_consing) {
 
-			if(node_fact) {
-				add_root_node(create_node(lexer::get_begin_token().get_id()), 0);
-				add_root_node(create_node(lexer::get_end_token().get_id()), 1);
+				token_iter = m_control_token_map.find(type);
+				if(token_iter != m_control_token_map.end()) {
+					result = token_iter->second;
+					++m_hash_cons_stats.tokens_saved;
+				} else {
+					result = lexer::create_token(type);
+					m_control_token_map.insert(std::pair<token_t, size_t>(type, result));
+				}
+			} else {
+				result = lexer::create_token(type);
 			}
 
-			m_statement_position = 0;
-
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
 		}
 
-		uuid 
+		node_rec_t 
 		_parser::create_node(
-			__in const uuid &token_id,
-			__in_opt size_t parent,
-			__in_opt const std::vector<size_t> &children
+			__in size_t token,
+			__in_opt size_t parent
 			)
 		{
-			node_factory_ptr node_fact;
-			std::vector<size_t>::const_iterator child_iter;
+			node_rec_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			node_fact = get_node_factory();
-			if(!node_fact) {
-				THROW_LUNA_PARSER_EXCEPTION(LUNA_PARSER_EXCEPTION_FACTORY_ALLOC_FAILED);
-			}
-
-			node &nd = node_fact->generate(token_id, parent);
-			
-			for(child_iter = children.begin(); child_iter != children.end(); ++child_iter) {
-				nd.add_child(*child_iter);
-			}
+			result.token = token;
+			result.parent = (parent == PARENT_NODE_NONE) ? NODE_RECORD_NONE : parent;
+			result.first = NODE_RECORD_NONE;
+			result.count = 0;
 
-			TRACE_EXIT("Return Value: %s", nd.to_string().c_str());
-			return nd.get_id();
+			TRACE_EXIT("Return Value: %lu", token);
+			return result;
 		}
 
 		size_t 
@@ -277,7 +281,7 @@ namespace LUNA_NS {
 
 size_t 
 		_parser::enumerate_assignment(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -286,19 +290,19 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(lexer::get_token().get_type() != TOKEN_IDENTIFIER) {
+			if(lexer::get_token_type() != TOKEN_IDENTIFIER) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_IDENTIFIER,
 					"%s", lexer::to_string().c_str());
 			}
 
 			enumerate_identifier_reference(stmt, parent);
 
-			if(lexer::get_token().get_type() != TOKEN_SYMBOL) {
+			if(lexer::get_token_type() != TOKEN_SYMBOL) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_ASSIGNMENT,
 					"%s", lexer::to_string().c_str());
 			}
 
-			switch(lexer::get_token().get_subtype()) {
+			switch(lexer::get_token_subtype()) {
 				case SYMBOL_ASSIGNMENT:
 					result = add_control_node(stmt, TOKEN_ASSIGNMENT, result);
 
@@ -320,12 +324,12 @@ size_t
 
 					lexer::move_next_token();
 
-					if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-							|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+					if((lexer::get_token_type() != TOKEN_SYMBOL)
+							|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 						enumerate_expression_list(stmt, result);
 
-						if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-								|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+						if((lexer::get_token_type() != TOKEN_SYMBOL)
+								|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 							THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 								"%s", lexer::to_string().c_str());
 						}
@@ -340,8 +344,8 @@ size_t
 						"%s", lexer::to_string().c_str());
 			}
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_TERMINATOR)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_TERMINATOR)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_TERMINATOR,
 					"%s", lexer::to_string().c_str());
 			}
@@ -356,7 +360,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_assignment_list(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -371,15 +375,15 @@ size_t
 			for(;;) {
 				result = list_loc;
 
-				if(lexer::get_token().get_type() != TOKEN_IDENTIFIER) {
+				if(lexer::get_token_type() != TOKEN_IDENTIFIER) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_IDENTIFIER,
 						"%s", lexer::to_string().c_str());
 				}
 
 				result = enumerate_identifier_reference(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_ASSIGNMENT)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_ASSIGNMENT)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_ASSIGNMENT,
 						"%s", lexer::to_string().c_str());
 				}
@@ -394,8 +398,8 @@ size_t
 				lexer::move_next_token();
 				enumerate_expression(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_SEPERATOR)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_SEPERATOR)) {
 					break;
 				}
 
@@ -413,7 +417,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_call(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -422,19 +426,19 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(lexer::get_token().get_type() != TOKEN_KEYWORD) {
+			if(lexer::get_token_type() != TOKEN_KEYWORD) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_KEYWORD,
 					"%s", lexer::to_string().c_str());
 			}
 
-			switch(lexer::get_token().get_subtype()) {
+			switch(lexer::get_token_subtype()) {
 				case KEYWORD_PRINT:
 
-					result = add_child_node(stmt, lexer::get_token().get_id(), parent);
+					result = add_child_node(stmt, lexer::get_token_row(), parent);
 					lexer::move_next_token();
 
-					if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-							|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
+					if((lexer::get_token_type() != TOKEN_SYMBOL)
+							|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
 						THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_PARENTHESIS,
 							"%s", lexer::to_string().c_str());
 					}
@@ -442,16 +446,16 @@ size_t
 					lexer::move_next_token();
 					enumerate_expression(stmt, result);
 
-					if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-							|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+					if((lexer::get_token_type() != TOKEN_SYMBOL)
+							|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 						THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 							"%s", lexer::to_string().c_str());
 					}
 
 					lexer::move_next_token();
 
-					if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-							|| (lexer::get_token().get_subtype() != SYMBOL_TERMINATOR)) {
+					if((lexer::get_token_type() != TOKEN_SYMBOL)
+							|| (lexer::get_token_subtype() != SYMBOL_TERMINATOR)) {
 						THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_TERMINATOR,
 							"%s", lexer::to_string().c_str());
 					}
@@ -471,7 +475,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_conditional_else(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -480,24 +484,24 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() != TOKEN_KEYWORD)
-					|| (lexer::get_token().get_subtype() != KEYWORD_ELSE)) {
+			if((lexer::get_token_type() != TOKEN_KEYWORD)
+					|| (lexer::get_token_subtype() != KEYWORD_ELSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_ELSE_CONDITIONAL,
 					"%s", lexer::to_string().c_str());
 			}
 
 			lexer::move_next_token();
 	
-			if((lexer::get_token().get_type() == TOKEN_KEYWORD)
-					&& (lexer::get_token().get_subtype() == KEYWORD_IF)) {
+			if((lexer::get_token_type() == TOKEN_KEYWORD)
+					&& (lexer::get_token_subtype() == KEYWORD_IF)) {
 				enumerate_conditional_if(stmt, parent);
 			} else {
 				lexer::move_previous_token();
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_BRACE,
 						"%s", lexer::to_string().c_str());
 				}
@@ -505,8 +509,8 @@ size_t
 				lexer::move_next_token();
 				enumerate_statement_list(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACE,
 						"%s", lexer::to_string().c_str());
 				}
@@ -522,7 +526,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_conditional_if(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -531,17 +535,17 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() != TOKEN_KEYWORD)
-					|| (lexer::get_token().get_subtype() != KEYWORD_IF)) {
+			if((lexer::get_token_type() != TOKEN_KEYWORD)
+					|| (lexer::get_token_subtype() != KEYWORD_IF)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_IF_CONDITIONAL,
 					"%s", lexer::to_string().c_str());
 			}
 
-			result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			result = add_child_node(stmt, lexer::get_token_row(), result);
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_PARENTHESIS,
 					"%s", lexer::to_string().c_str());
 			}
@@ -549,16 +553,16 @@ size_t
 			lexer::move_next_token();
 			enumerate_condition_list(stmt, result);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 					"%s", lexer::to_string().c_str());
 			}
 
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -566,8 +570,8 @@ size_t
 			lexer::move_next_token();
 			enumerate_statement_list(stmt, result);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -575,8 +579,8 @@ size_t
 			if(lexer::has_next_token()) {
 				lexer::move_next_token();
 
-				while((lexer::get_token().get_type() == TOKEN_KEYWORD)
-						&& (lexer::get_token().get_subtype() == KEYWORD_ELSE)) {
+				while((lexer::get_token_type() == TOKEN_KEYWORD)
+						&& (lexer::get_token_subtype() == KEYWORD_ELSE)) {
 
 					if(!lexer::has_next_token()) {
 						THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_ELSE_CONDITIONAL,
@@ -593,7 +597,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_condition_list(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -607,11 +611,11 @@ size_t
 			for(;;) {
 				enumerate_expression_compound(stmt, result);
 
-				if(lexer::get_token().get_type() != TOKEN_OPERATOR) {
+				if(lexer::get_token_type() != TOKEN_OPERATOR) {
 					break;
 				}
 
-				add_child_node(stmt, lexer::get_token().get_id(), result);
+				add_child_node(stmt, lexer::get_token_row(), result);
 
 				if(!lexer::has_next_token()) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CONDITIONAL_EXPRESSION,
@@ -627,7 +631,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_conditional_statement(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -636,12 +640,12 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(lexer::get_token().get_type() != TOKEN_KEYWORD) {
+			if(lexer::get_token_type() != TOKEN_KEYWORD) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_KEYWORD,
 					"%s", lexer::to_string().c_str());
 			}
 
-			switch(lexer::get_token().get_subtype()) {
+			switch(lexer::get_token_subtype()) {
 				case KEYWORD_IF:
 					enumerate_conditional_if(stmt, result);
 					break;
@@ -659,7 +663,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_conditional_while(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -668,11 +672,11 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			result = add_child_node(stmt, lexer::get_token_row(), result);
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_PARENTHESIS,
 					"%s", lexer::to_string().c_str());
 			}
@@ -680,16 +684,16 @@ size_t
 			lexer::move_next_token();
 			enumerate_condition_list(stmt, result);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 					"%s", lexer::to_string().c_str());
 			}
 
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -697,8 +701,8 @@ size_t
 			lexer::move_next_token();
 			enumerate_statement_list(stmt, result);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -713,7 +717,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_control(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -722,16 +726,16 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(lexer::get_token().get_type() != TOKEN_CONTROL) {
+			if(lexer::get_token_type() != TOKEN_CONTROL) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CONTROL,
 					"%s", lexer::to_string().c_str());
 			}
 
-			result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			result = add_child_node(stmt, lexer::get_token_row(), result);
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_TERMINATOR)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_TERMINATOR)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_TERMINATOR,
 					"%s", lexer::to_string().c_str());
 			}
@@ -746,7 +750,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -757,10 +761,10 @@ size_t
 
 			result = add_control_node(stmt, TOKEN_EXPRESSION, parent);
 
-			switch(lexer::get_token().get_type()) {
+			switch(lexer::get_token_type()) {
 				case TOKEN_KEYWORD:
 
-					if(lexer::get_token().get_subtype() == KEYWORD_FUNCT) {
+					if(lexer::get_token_subtype() == KEYWORD_FUNCT) {
 						enumerate_expression_function(stmt, result);
 					} else {
 						enumerate_expression_struct(stmt, result);
@@ -768,7 +772,7 @@ size_t
 					break;
 				case TOKEN_SYMBOL:
 
-					switch(lexer::get_token().get_subtype()) {
+					switch(lexer::get_token_subtype()) {
 						case SYMBOL_NEGATIVE:
 						case SYMBOL_PARENTHESIS_OPEN:
 							enumerate_expression_compound(stmt, result);
@@ -789,7 +793,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_array_list(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -798,8 +802,8 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -808,8 +812,8 @@ size_t
 			lexer::move_next_token();
 			enumerate_expression_list(stmt, result);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -824,7 +828,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_compound(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -836,16 +840,16 @@ size_t
 
 			result = add_control_node(stmt, TOKEN_EXPRESSION_COMPOUND, result);
 
-			if((lexer::get_token().get_type() == TOKEN_SYMBOL)
-					&& (lexer::get_token().get_subtype() == SYMBOL_PARENTHESIS_OPEN)) {
+			if((lexer::get_token_type() == TOKEN_SYMBOL)
+					&& (lexer::get_token_subtype() == SYMBOL_PARENTHESIS_OPEN)) {
 
-				while((lexer::get_token().get_type() == TOKEN_SYMBOL)
-						&& (lexer::get_token().get_subtype() == SYMBOL_PARENTHESIS_OPEN)) {
+				while((lexer::get_token_type() == TOKEN_SYMBOL)
+						&& (lexer::get_token_subtype() == SYMBOL_PARENTHESIS_OPEN)) {
 					lexer::move_next_token();
 					++nest_count;
 				}
 
-				type = lexer::get_token().get_type();
+				type = lexer::get_token_type();
 
 				while(nest_count--) {
 					lexer::move_previous_token();
@@ -856,13 +860,13 @@ size_t
 				} else {
 					result = enumerate_expression_numeric(stmt, result);
 				}
-			} else if(lexer::get_token().get_type() == TOKEN_LITERAL_STRING) {
+			} else if(lexer::get_token_type() == TOKEN_LITERAL_STRING) {
 				result = enumerate_expression_string(stmt, result);
 			} else {
 				result = enumerate_expression_numeric(stmt, result);
 			}
 
-			switch(lexer::get_token().get_type()) {
+			switch(lexer::get_token_type()) {
 			case TOKEN_LITERAL_STRING:
 				break;
 			}
@@ -873,7 +877,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_function(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -882,29 +886,29 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() != TOKEN_KEYWORD)
-					|| (lexer::get_token().get_subtype() != KEYWORD_FUNCT)) {
+			if((lexer::get_token_type() != TOKEN_KEYWORD)
+					|| (lexer::get_token_subtype() != KEYWORD_FUNCT)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_FUNCTION,
 					"%s", lexer::to_string().c_str());
 			}
 
-			result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			result = add_child_node(stmt, lexer::get_token_row(), result);
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_PARENTHESIS,
 					"%s", lexer::to_string().c_str());
 			}
 
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 				enumerate_identifier_list(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 						"%s", lexer::to_string().c_str());
 				}
@@ -912,8 +916,8 @@ size_t
 
 			lexer::move_next_token();
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -921,8 +925,8 @@ size_t
 			lexer::move_next_token();
 			enumerate_statement_list(stmt, parent);
 
-			if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-					|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
+			if((lexer::get_token_type() != TOKEN_SYMBOL)
+					|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACE,
 					"%s", lexer::to_string().c_str());
 			}
@@ -937,7 +941,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_list(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -951,8 +955,8 @@ size_t
 			for(;;) {
 				enumerate_expression(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_SEPERATOR)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_SEPERATOR)) {
 					break;
 				}
 
@@ -970,7 +974,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -988,7 +992,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_0p(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -997,8 +1001,8 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(lexer::get_token().get_type() == TOKEN_BINARY_OPERATOR) {
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			if(lexer::get_token_type() == TOKEN_BINARY_OPERATOR) {
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 				enumerate_expression_numeric_1(stmt, result);
 				enumerate_expression_numeric_0p(stmt, result);
@@ -1010,7 +1014,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_1(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1028,7 +1032,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_1p(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1037,8 +1041,8 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(lexer::get_token().get_type() == TOKEN_SHIFT_OPEATOR) {
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			if(lexer::get_token_type() == TOKEN_SHIFT_OPEATOR) {
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 				enumerate_expression_numeric_2(stmt, result);
 				enumerate_expression_numeric_1p(stmt, result);
@@ -1050,7 +1054,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_2(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1068,7 +1072,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_2p(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1077,9 +1081,9 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() == TOKEN_ARITHMETIC_OPERATOR)
-					&& (lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_SUBTRACTION)) {
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			if((lexer::get_token_type() == TOKEN_ARITHMETIC_OPERATOR)
+					&& (lexer::get_token_subtype() == ARITHMETIC_OPERATOR_SUBTRACTION)) {
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 				enumerate_expression_numeric_3(stmt, result);
 				enumerate_expression_numeric_2p(stmt, result);
@@ -1091,7 +1095,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_3(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1109,7 +1113,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_3p(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1118,9 +1122,9 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() == TOKEN_ARITHMETIC_OPERATOR)
-					&& (lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_ADDITION)) {
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			if((lexer::get_token_type() == TOKEN_ARITHMETIC_OPERATOR)
+					&& (lexer::get_token_subtype() == ARITHMETIC_OPERATOR_ADDITION)) {
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 				enumerate_expression_numeric_4(stmt, result);
 				enumerate_expression_numeric_3p(stmt, result);
@@ -1132,7 +1136,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_4(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1150,7 +1154,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_4p(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1159,10 +1163,10 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() == TOKEN_ARITHMETIC_OPERATOR)
-					&& ((lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_DIVISION)
-					|| (lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_MODULUS))) {
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			if((lexer::get_token_type() == TOKEN_ARITHMETIC_OPERATOR)
+					&& ((lexer::get_token_subtype() == ARITHMETIC_OPERATOR_DIVISION)
+					|| (lexer::get_token_subtype() == ARITHMETIC_OPERATOR_MODULUS))) {
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 				enumerate_expression_numeric_5(stmt, result);
 				enumerate_expression_numeric_4p(stmt, result);
@@ -1174,7 +1178,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_5(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1192,7 +1196,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_5p(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1201,9 +1205,9 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() == TOKEN_ARITHMETIC_OPERATOR)
-					&& (lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_MULTIPLICATION)) {
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+			if((lexer::get_token_type() == TOKEN_ARITHMETIC_OPERATOR)
+					&& (lexer::get_token_subtype() == ARITHMETIC_OPERATOR_MULTIPLICATION)) {
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 				enumerate_expression_numeric_6(stmt, result);
 				enumerate_expression_numeric_5p(stmt, result);
@@ -1215,7 +1219,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_numeric_6(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1224,7 +1228,7 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			switch(lexer::get_token().get_type()) {
+			switch(lexer::get_token_type()) {
 				case TOKEN_IDENTIFIER:
 					result = enumerate_identifier_reference(stmt, result);
 					break;
@@ -1233,18 +1237,18 @@ size_t
 				case TOKEN_LITERAL_CHARACTER:
 				case TOKEN_NULL:
 				case TOKEN_SCALAR:
-					result = add_child_node(stmt, lexer::get_token().get_id(), result);
+					result = add_child_node(stmt, lexer::get_token_row(), result);
 					lexer::move_next_token();
 					break;
 				case TOKEN_SYMBOL:
 
-					switch(lexer::get_token().get_subtype()) {
+					switch(lexer::get_token_subtype()) {
 						case SYMBOL_PARENTHESIS_OPEN:
 							lexer::move_next_token();
 							enumerate_expression_numeric(stmt, result);
 
-							if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-									|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+							if((lexer::get_token_type() != TOKEN_SYMBOL)
+									|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 								THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 									"%s", lexer::to_string().c_str());
 							}
@@ -1254,7 +1258,7 @@ size_t
 							}
 							break;
 						case SYMBOL_NEGATIVE:
-							result = add_child_node(stmt, lexer::get_token().get_id(), result);
+							result = add_child_node(stmt, lexer::get_token_row(), result);
 							lexer::move_next_token();
 							enumerate_expression_numeric(stmt, result);
 							break;
@@ -1274,7 +1278,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_string(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1283,13 +1287,13 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if((lexer::get_token().get_type() == TOKEN_SYMBOL)
-						&& (lexer::get_token().get_subtype() == SYMBOL_PARENTHESIS_OPEN)) {
+			if((lexer::get_token_type() == TOKEN_SYMBOL)
+						&& (lexer::get_token_subtype() == SYMBOL_PARENTHESIS_OPEN)) {
 				lexer::move_next_token();
 				enumerate_expression_string(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_PARENTHESIS_CLOSE)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_PARENTHESIS,
 						"%s", lexer::to_string().c_str());
 				}
@@ -1298,25 +1302,25 @@ size_t
 					lexer::move_next_token();
 				}
 
-				if((lexer::get_token().get_type() == TOKEN_ARITHMETIC_OPERATOR)
-							&& (lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_ADDITION)) {
-					result = add_child_node(stmt, lexer::get_token().get_id(), result);
+				if((lexer::get_token_type() == TOKEN_ARITHMETIC_OPERATOR)
+							&& (lexer::get_token_subtype() == ARITHMETIC_OPERATOR_ADDITION)) {
+					result = add_child_node(stmt, lexer::get_token_row(), result);
 					lexer::move_next_token();
 					enumerate_expression_compound(stmt, result);
 				}
-			} else if(lexer::get_token().get_type() != TOKEN_LITERAL_STRING) {
+			} else if(lexer::get_token_type() != TOKEN_LITERAL_STRING) {
 				THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_STRING,
 					"%s", lexer::to_string().c_str());
 			} else {
-				add_child_node(stmt, lexer::get_token().get_id(), result);
+				add_child_node(stmt, lexer::get_token_row(), result);
 			
 				if(lexer::has_next_token()) {
 					lexer::move_next_token();
 				}
 
-				if((lexer::get_token().get_type() == TOKEN_ARITHMETIC_OPERATOR)
-							&& (lexer::get_token().get_subtype() == ARITHMETIC_OPERATOR_ADDITION)) {
-					result = add_child_node(stmt, lexer::get_token().get_id(), result);
+				if((lexer::get_token_type() == TOKEN_ARITHMETIC_OPERATOR)
+							&& (lexer::get_token_subtype() == ARITHMETIC_OPERATOR_ADDITION)) {
+					result = add_child_node(stmt, lexer::get_token_row(), result);
 					lexer::move_next_token();
 					enumerate_expression_compound(stmt, result);
 				}
@@ -1328,7 +1332,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_expression_struct(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1337,17 +1341,17 @@ size_t
 				TRACE_ENTRY();
 				SERIALIZE_CALL_RECUR(m_lock);
 
-				if((lexer::get_token().get_type() != TOKEN_KEYWORD)
-						|| (lexer::get_token().get_subtype() != KEYWORD_STRUCT)) {
+				if((lexer::get_token_type() != TOKEN_KEYWORD)
+						|| (lexer::get_token_subtype() != KEYWORD_STRUCT)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_STRUCT,
 						"%s", lexer::to_string().c_str());
 				}
 
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_OPEN)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_OPENING_BRACE,
 						"%s", lexer::to_string().c_str());
 				}
@@ -1355,8 +1359,8 @@ size_t
 				lexer::move_next_token();
 				enumerate_assignment_list(stmt, result);
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_CURLY_BRACE_CLOSE)) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACE,
 						"%s", lexer::to_string().c_str());
 				}
@@ -1371,7 +1375,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_identifier_list(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1384,16 +1388,16 @@ size_t
 
 			for(;;) {
 
-				if(lexer::get_token().get_type() != TOKEN_IDENTIFIER) {
+				if(lexer::get_token_type() != TOKEN_IDENTIFIER) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_IDENTIFIER,
 						"%s", lexer::to_string().c_str());
 				}
 
-				add_child_node(stmt, lexer::get_token().get_id(), result);
+				add_child_node(stmt, lexer::get_token_row(), result);
 				lexer::move_next_token();
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_SEPERATOR)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_SEPERATOR)) {
 					break;
 				}
 
@@ -1411,7 +1415,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_identifier_reference(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1422,12 +1426,12 @@ size_t
 
 			for(;;) {
 
-				if(lexer::get_token().get_type() != TOKEN_IDENTIFIER) {
+				if(lexer::get_token_type() != TOKEN_IDENTIFIER) {
 					THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_IDENTIFIER,
 						"%s", lexer::to_string().c_str());
 				}
 
-				result = add_child_node(stmt, lexer::get_token().get_id(), result);
+				result = add_child_node(stmt, lexer::get_token_row(), result);
 
 				if(!lexer::has_next_token()) {
 					break;
@@ -1435,8 +1439,8 @@ size_t
 
 				lexer::move_next_token();
 
-				if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-						|| (lexer::get_token().get_subtype() != SYMBOL_REFERENCE)) {
+				if((lexer::get_token_type() != TOKEN_SYMBOL)
+						|| (lexer::get_token_subtype() != SYMBOL_REFERENCE)) {
 					break;
 				}
 
@@ -1445,17 +1449,17 @@ size_t
 
 			if(lexer::has_next_token()) {
 				
-				if((lexer::get_token().get_type() == TOKEN_SYMBOL) 
-						&& (lexer::get_token().get_subtype() == SYMBOL_SQUARE_BRACKET_OPEN)) {
+				if((lexer::get_token_type() == TOKEN_SYMBOL) 
+						&& (lexer::get_token_subtype() == SYMBOL_SQUARE_BRACKET_OPEN)) {
 					lexer::move_next_token(true);
 					result = add_control_node(stmt, TOKEN_ARRAY_INDEX, result);
 
-					switch(lexer::get_token().get_type()) {
+					switch(lexer::get_token_type()) {
 						case TOKEN_IDENTIFIER:
 							result = enumerate_identifier_reference(stmt, result);
 							break;
 						case TOKEN_SCALAR:
-							result = add_child_node(stmt, lexer::get_token().get_id(), result);
+							result = add_child_node(stmt, lexer::get_token_row(), result);
 
 							if(!lexer::has_next_token()) {
 								THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACKET,
@@ -1469,8 +1473,8 @@ size_t
 								"%s", lexer::to_string().c_str());
 					}
 
-					if((lexer::get_token().get_type() != TOKEN_SYMBOL)
-							|| (lexer::get_token().get_subtype() != SYMBOL_SQUARE_BRACKET_CLOSE)) {
+					if((lexer::get_token_type() != TOKEN_SYMBOL)
+							|| (lexer::get_token_subtype() != SYMBOL_SQUARE_BRACKET_CLOSE)) {
 						THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_EXPECTING_CLOSING_BRACKET,
 							"%s", lexer::to_string().c_str());
 					}
@@ -1487,12 +1491,11 @@ size_t
 
 		size_t 
 		_parser::enumerate_statement(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent,
 			__in_opt bool root
 			)
 		{
-			uuid node_id;
 			size_t result = parent;
 
 			TRACE_ENTRY();
@@ -1502,7 +1505,7 @@ size_t
 				result = add_control_node(stmt, TOKEN_STATEMENT, result);
 			}
 
-			switch(lexer::get_token().get_type()) {
+			switch(lexer::get_token_type()) {
 				case TOKEN_CONTROL:
 					enumerate_control(stmt, result);
 					break;
@@ -1511,7 +1514,7 @@ size_t
 					break;
 				case TOKEN_KEYWORD:
 					
-					switch(lexer::get_token().get_subtype()) {
+					switch(lexer::get_token_subtype()) {
 						case KEYWORD_PRINT:
 							enumerate_call(stmt, result);
 							break;
@@ -1531,7 +1534,7 @@ size_t
 
 		size_t 
 		_parser::enumerate_statement_list(
-			__in statement_t &stmt,
+			__in node_list_t &stmt,
 			__in_opt size_t parent
 			)
 		{
@@ -1544,9 +1547,9 @@ size_t
 
 			for(;;) {
 				
-				if((lexer::get_token().get_type() != TOKEN_CONTROL)
-						&& (lexer::get_token().get_type() != TOKEN_IDENTIFIER)
-						&& (lexer::get_token().get_type() != TOKEN_KEYWORD)) {
+				if((lexer::get_token_type() != TOKEN_CONTROL)
+						&& (lexer::get_token_type() != TOKEN_IDENTIFIER)
+						&& (lexer::get_token_type() != TOKEN_KEYWORD)) {
 					break;
 				}
 
@@ -1569,20 +1572,31 @@ size_t
 			return get_statement(m_statement_list.size() - 1);
 		}
 
-		node_factory_ptr 
-		_parser::get_node_factory(void)
+		hash_cons_stats_t 
+		_parser::get_hash_cons_stats(void)
 		{
-			node_factory_ptr result = NULL;
+			hash_cons_stats_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(luna::is_globally_initialized()) {
-				
-				if(get_context()->is_initialized()) {
-					result = get_context()->acquire_node_factory();
-				}
-			}
+			result = m_hash_cons_stats;
+			result.bytes_saved = (result.nodes_saved * sizeof(node_rec_t)) 
+				+ (result.tokens_saved * HASH_CONS_TOKEN_BYTES);
+
+			TRACE_EXIT("Return Value: %lu", result.bytes_saved);
+			return result;
+		}
+
+		node_arena_ptr 
+		_parser::get_node_arena(void)
+		{
+			node_arena_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_context->get_node_arena();
 
 			TRACE_EXIT("Return Value: 0x%p", result);
 			return result;
@@ -1628,12 +1642,45 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = (get_statement().front().get_id() != get_end_statement().front().get_id());
+			result = (get_statement().first != get_end_statement().first);
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
+		uint64_t 
+		_parser::hash_token(
+			__in size_t token
+			)
+		{
+			double value;
+			std::string text;
+			uint64_t bits, result = HASH_CONS_SEED;
+			std::string::iterator text_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			value = m_token_table.get_value(token);
+			std::memcpy(&bits, &value, sizeof(bits));
+			result = HASH_CONS_MIX(result, m_token_table.get_type(token));
+			result = HASH_CONS_MIX(result, m_token_table.get_subtype(token));
+			result = HASH_CONS_MIX(result, bits);
+			result = HASH_CONS_MIX(result, m_token_table.get_atom(token));
+
+			if((m_token_table.get_atom(token) == ATOM_INVALID)
+					&& m_token_table.has_text(token)) {
+				text = m_token_table.get_text(token);
+
+				for(text_iter = text.begin(); text_iter != text.end(); ++text_iter) {
+					result = HASH_CONS_MIX(result, (uint8_t) *text_iter);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
 		bool 
 		_parser::has_previous_statement(void)
 		{
@@ -1648,6 +1695,197 @@ size_t
 			return result;
 		}
 
+		bool 
+		_parser::is_equal_subtree(
+			__in const node_list_t &stmt,
+			__in size_t position,
+			__in size_t index
+			)
+		{
+			bool result = true;
+			node_arena_ptr arena;
+			size_t child, iter, left, right;
+			std::vector<std::pair<size_t, size_t>> pair_list;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			arena = get_node_arena();
+			pair_list.push_back(std::pair<size_t, size_t>(position, index));
+
+			while(result && !pair_list.empty()) {
+				left = pair_list.back().first;
+				right = pair_list.back().second;
+				pair_list.pop_back();
+
+				node_rec_t &nd = arena->get_node(right);
+				result = ((stmt.at(left).count == nd.count) 
+					&& is_equal_token(stmt.at(left).token, nd.token));
+
+				if(result && nd.count) {
+					child = nd.first;
+
+					for(iter = 0; iter < nd.count; ++iter) {
+						pair_list.push_back(std::pair<size_t, size_t>(
+							m_share_child_list[m_share_child_offset[left] + iter], child));
+						child = arena->get_sibling(child);
+					}
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_parser::is_equal_token(
+			__in size_t left,
+			__in size_t right
+			)
+		{
+			bool result = true;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(left != right) {
+				result = ((m_token_table.get_type(left) == m_token_table.get_type(right))
+					&& (m_token_table.get_subtype(left) == m_token_table.get_subtype(right))
+					&& (m_token_table.get_atom(left) == m_token_table.get_atom(right))
+					&& (m_token_table.get_value(left) == m_token_table.get_value(right))
+					&& (m_token_table.has_text(left) == m_token_table.has_text(right)));
+
+				if(result && (m_token_table.get_atom(left) == ATOM_INVALID)
+						&& m_token_table.has_text(left)) {
+					result = (m_token_table.get_text(left) == m_token_table.get_text(right));
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_parser::is_hash_consing(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", m_hash_consing);
+			return m_hash_consing;
+		}
+
+		bool 
+		_parser::is_shareable_token(
+			__in size_t token
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			switch(m_token_table.get_type(token)) {
+				case TOKEN_ARRAY_LIST:
+				case TOKEN_ARITHMETIC_OPERATOR:
+				case TOKEN_ARRAY_INDEX:
+				case TOKEN_BINARY_OPERATOR:
+				case TOKEN_BOOLEAN:
+				case TOKEN_EXPRESSION:
+				case TOKEN_EXPRESSION_COMPOUND:
+				case TOKEN_EXPRESSION_LIST:
+				case TOKEN_FLOAT:
+				case TOKEN_IDENTIFIER:
+				case TOKEN_LITERAL_CHARACTER:
+				case TOKEN_LITERAL_STRING:
+				case TOKEN_OPERATOR:
+				case TOKEN_NULL:
+				case TOKEN_SCALAR:
+				case TOKEN_SHIFT_OPEATOR:
+					result = true;
+					break;
+				default:
+					result = false;
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_parser::linearize(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			get_node_arena()->set_layout(NODE_LAYOUT_PREORDER);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		bool 
+		_parser::load_image(
+			__in_opt const std::string &directory
+			)
+		{
+			bool result;
+			size_t base, count, iter, length, position;
+			node_arena_ptr arena;
+			image_reader reader;
+			statement_t stmt;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = reader.open(image_path(directory, m_text));
+			if(result) {
+				const image_header_t &header = reader.get_header();
+
+				result = ((header.hash == image_hash(m_text)) && (header.length == m_text.size()));
+			}
+
+			if(result) {
+
+				try {
+					parser::clear();
+					lexer::load(reader);
+
+					arena = get_node_arena();
+					base = arena->load(reader, m_token_table.size());
+					m_statement_list.clear();
+
+					count = reader.read_value();
+					for(iter = 0; iter < count; ++iter) {
+						position = reader.read_value();
+						length = reader.read_value();
+
+						if((position > (arena->size() - base)) || (length > (arena->size() - base - position))) {
+							THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
+								"pos/len/max: %lu/%lu/%lu", position, length, (arena->size() - base));
+						}
+
+						stmt.first = base + position;
+						stmt.second = length;
+						m_statement_list.push_back(stmt);
+					}
+
+					if(m_statement_list.size() < SENTINEL_COUNT) {
+						THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
+							"pos/max: %lu/%lu", m_statement_position, m_statement_list.size());
+					}
+
+					m_statement_position = 0;
+				} catch(...) {
+					lexer::clear();
+					parser::clear();
+					throw;
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
 		statement_t &
 		_parser::move_next_statement(
 			__in_opt bool expect_next
@@ -1661,14 +1899,24 @@ size_t
 					: LUNA_PARSER_EXCEPTION_NO_NEXT_STATEMENT);
 			}
 
-			if(lexer::get_token().get_id() == lexer::get_begin_token().get_id()) {
+			if(lexer::get_token_row() == lexer::get_token_row(0)) {
 				move_next_token();
 			}
 
 			if(lexer::has_next_token() 
 					&& (m_statement_position == (m_statement_list.size() - SENTINEL_COUNT))) {
-				statement_t &stmt = add_control_node(TOKEN_STATEMENT, m_statement_position + 1);
-				enumerate_statement(stmt, 0, true);
+				m_statement_scratch.assign(1, create_node(create_control_token(TOKEN_STATEMENT)));
+				enumerate_statement(m_statement_scratch, 0, true);
+
+				if(m_hash_consing) {
+					share_subtrees(m_statement_scratch);
+				}
+
+				add_statement(m_statement_scratch, m_statement_position + 1);
+
+				if(m_hash_consing) {
+					register_subtrees();
+				}
 			}
 
 			++m_statement_position;
@@ -1696,6 +1944,27 @@ size_t
 			return get_statement();
 		}
 
+		void 
+		_parser::register_subtrees(void)
+		{
+			node_arena_ptr arena;
+			std::vector<std::pair<size_t, uint64_t>>::iterator pending_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			arena = get_node_arena();
+
+			for(pending_iter = m_share_pending.begin(); pending_iter != m_share_pending.end(); 
+					++pending_iter) {
+				arena->add_shared(pending_iter->second, arena->get_tree_position(pending_iter->first));
+			}
+
+			m_share_pending.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
 		void 
 		_parser::reset(void)
 		{
@@ -1707,6 +1976,41 @@ size_t
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		std::string 
+		_parser::save_image(
+			__in_opt const std::string &directory
+			)
+		{
+			size_t position;
+			std::string result;
+			node_arena_ptr arena;
+			image_writer writer(m_text);
+			std::vector<statement_t>::iterator stmt_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			position = m_statement_position;
+			parser::discover();
+			lexer::save(writer);
+
+			arena = get_node_arena();
+			arena->save(writer);
+			writer.write_value(m_statement_list.size());
+
+			for(stmt_iter = m_statement_list.begin(); stmt_iter != m_statement_list.end(); ++stmt_iter) {
+				writer.write_value(stmt_iter->first);
+				writer.write_value(stmt_iter->second);
+			}
+
+			result = image_path(directory, m_text);
+			writer.save(result);
+			m_statement_position = position;
+
+			TRACE_EXIT("Return Value: %s", result.c_str());
+			return result;
+		}
+
 		void 
 		_parser::set(
 			__in const std::string &input,
@@ -1722,6 +2026,121 @@ size_t
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		void 
+		_parser::set_hash_consing(
+			__in bool enabled
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_hash_consing = enabled;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_parser::share_subtrees(
+			__in node_list_t &stmt
+			)
+		{
+			node_arena_ptr arena;
+			size_t canonical, iter, parent;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			arena = get_node_arena();
+			m_share_pending.clear();
+			m_share_hash.resize(stmt.size());
+			m_share_size.assign(stmt.size(), 1);
+			m_share_state.resize(stmt.size());
+			m_share_child_offset.assign(stmt.size() + 1, 0);
+			m_share_child_list.resize(stmt.size());
+
+			for(iter = 0; iter < stmt.size(); ++iter) {
+				m_share_hash[iter] = hash_token(stmt[iter].token);
+				m_share_state[iter] = is_shareable_token(stmt[iter].token) ? SHARE_STATE_ELIGIBLE 
+					: SHARE_STATE_INELIGIBLE;
+				m_share_child_offset[iter + 1] = m_share_child_offset[iter] + stmt[iter].count;
+			}
+
+			for(iter = stmt.size() - 1; iter > 0; --iter) {
+				parent = stmt[iter].parent;
+				m_share_hash[parent] = HASH_CONS_MIX(m_share_hash[parent], m_share_hash[iter]);
+				m_share_size[parent] += m_share_size[iter];
+
+				if(m_share_state[iter] == SHARE_STATE_INELIGIBLE) {
+					m_share_state[parent] = SHARE_STATE_INELIGIBLE;
+				}
+			}
+
+			for(iter = 1; iter < stmt.size(); ++iter) {
+				parent = stmt[iter].parent;
+				m_share_child_list[m_share_child_offset[parent]++] = iter;
+			}
+
+			for(iter = stmt.size(); iter > 0; --iter) {
+				m_share_child_offset[iter] = m_share_child_offset[iter - 1];
+			}
+
+			m_share_child_offset[0] = 0;
+
+			for(iter = 0; iter < stmt.size(); ++iter) {
+				parent = stmt[iter].parent;
+
+				if((parent != NODE_RECORD_NONE) 
+						&& ((m_share_state[parent] == SHARE_STATE_LINK) 
+						|| (m_share_state[parent] == SHARE_STATE_DROP))) {
+					m_share_state[iter] = SHARE_STATE_DROP;
+					continue;
+				}
+
+				if((m_share_state[iter] == SHARE_STATE_ELIGIBLE) && (m_share_size[iter] > 1)) {
+					++m_hash_cons_stats.lookups;
+
+					canonical = arena->find_shared(m_share_hash[iter]);
+					if(canonical == NODE_RECORD_NONE) {
+						m_share_pending.push_back(std::pair<size_t, uint64_t>(iter, m_share_hash[iter]));
+					} else if(is_equal_subtree(stmt, iter, canonical)) {
+						stmt[iter].first = arena->get_node(canonical).first;
+						stmt[iter].count = arena->get_node(canonical).count;
+						m_share_state[iter] = SHARE_STATE_LINK;
+						m_hash_cons_stats.nodes_saved += (m_share_size[iter] - 1);
+						++m_hash_cons_stats.hits;
+						continue;
+					}
+				}
+
+				m_share_state[iter] = SHARE_STATE_KEEP;
+			}
+
+			m_share_list.clear();
+
+			for(iter = 0; iter < stmt.size(); ++iter) {
+
+				if(m_share_state[iter] == SHARE_STATE_DROP) {
+					continue;
+				}
+
+				parent = stmt[iter].parent;
+				m_share_size[iter] = m_share_list.size();
+				m_share_list.push_back(stmt[iter]);
+
+				if(parent != NODE_RECORD_NONE) {
+					m_share_list.back().parent = m_share_size[parent];
+				}
+			}
+
+			for(iter = 0; iter < m_share_pending.size(); ++iter) {
+				m_share_pending[iter].first = m_share_size[m_share_pending[iter].first];
+			}
+
+			stmt.swap(m_share_list);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
 		size_t 
 		_parser::size(void)
 		{
@@ -1742,28 +2161,16 @@ size_t
 			__in_opt bool verbose
 			)
 		{
+			node_arena_ptr arena;
 			std::stringstream result;
-			node_factory_ptr node_fact;
-			token_factory_ptr tok_fact;
-			statement_t::const_iterator stmt_iter;
-			std::queue<std::pair<uuid, size_t>> node_que;
+			std::queue<std::pair<size_t, size_t>> node_que;
 			size_t child_pos, pos_iter, tab_count, tab_iter;
 
 			TRACE_ENTRY();
 
-			if(!stmt.empty()) {
-				
-				tok_fact = lexer::get_token_factory();
-				if(!tok_fact) {
-					THROW_LUNA_PARSER_EXCEPTION(LUNA_PARSER_EXCEPTION_FACTORY_ALLOC_FAILED);
-				}
-
-				node_fact = get_node_factory();
-				if(!node_fact) {
-					THROW_LUNA_PARSER_EXCEPTION(LUNA_PARSER_EXCEPTION_FACTORY_ALLOC_FAILED);
-				}
-
-				node_que.push(std::pair<uuid, size_t>(stmt.front(), 0));
+			if(stmt.second) {
+				arena = get_node_arena();
+				node_que.push(std::pair<size_t, size_t>(stmt.first, 0));
 
 				while(!node_que.empty()) {
 					
@@ -1780,16 +2187,16 @@ size_t
 						result << " ";
 					}
 
-					node &nd = node_fact->get_node(node_que.front().first);
-					result << tok_fact->get_token(nd.get_token_id()).to_string(verbose) << " [" << nd.get_child_count() << "]";
+					node_rec_t &nd = arena->get_node(node_que.front().first);
+					result << m_token_table.token_as_string(nd.token, verbose) << " [" << nd.count << "]";
 
-					if(nd.is_leaf() || nd.is_root()) {
+					if(!nd.count || (nd.parent == NODE_RECORD_NONE)) {
 						result << " (";
 
-						if(nd.is_root()) {
+						if(nd.parent == NODE_RECORD_NONE) {
 							result << "ROOT";
 
-							if(nd.is_leaf()) {
+							if(!nd.count) {
 								result << ", LEAF";
 							}
 						} else {
@@ -1799,15 +2206,17 @@ size_t
 						result << ")";
 					}
 
-					for(pos_iter = 0; pos_iter < nd.get_child_count(); ++pos_iter) {
-						child_pos = nd.get_child(pos_iter);
+					child_pos = nd.first;
+
+					for(pos_iter = 0; pos_iter < nd.count; ++pos_iter) {
 
-						if(child_pos >= stmt.size()) {
+						if(child_pos >= arena->size()) {
 							THROW_LUNA_PARSER_EXCEPTION_MESSAGE(LUNA_PARSER_EXCEPTION_INVALID_CHILD_STATEMENT_POSITION,
-								"pos/max: %lu/%lu", child_pos, (stmt.size() - 1));
+								"pos/max: %lu/%lu", child_pos, (arena->size() - 1));
 						}
 
-						node_que.push(std::pair<uuid, size_t>(stmt.at(child_pos), tab_count + 1));
+						node_que.push(std::pair<size_t, size_t>(child_pos, tab_count + 1));
+						child_pos = arena->get_sibling(child_pos);
 					}
 
 					--tab_count;
@@ -20,13 +20,23 @@
 #ifndef LUNA_PARSER_H_
 #define LUNA_PARSER_H_
 
+#include <map>
+
 namespace LUNA_NS {
 
 	using namespace LUNA_COMP_NS;
 
 	namespace LUNA_LANG_NS {
 	
-		typedef std::vector<uuid> statement_t, *statement_ptr_t;
+		typedef std::pair<size_t, size_t> statement_t, *statement_ptr_t;
+
+		typedef struct {
+			size_t lookups;
+			size_t hits;
+			size_t nodes_saved;
+			size_t tokens_saved;
+			size_t bytes_saved;
+		} hash_cons_stats_t, *hash_cons_stats_ptr_t;
 
 		typedef class _parser:
 				protected lexer {
@@ -58,6 +68,8 @@ namespace LUNA_NS {
 
 				statement_t &get_end_statement(void);
 
+				hash_cons_stats_t get_hash_cons_stats(void);
+
 				statement_t &get_statement(void);
 
 				statement_t &get_statement(
@@ -70,6 +82,14 @@ namespace LUNA_NS {
 
 				bool has_previous_statement(void);
 
+				bool is_hash_consing(void);
+
+				void linearize(void);
+
+				bool load_image(
+					__in_opt const std::string &directory = std::string()
+					);
+
 				statement_t &move_next_statement(
 					__in_opt bool expect_next = false
 					);
@@ -80,11 +100,19 @@ namespace LUNA_NS {
 
 				virtual void reset(void);
 
+				std::string save_image(
+					__in_opt const std::string &directory = std::string()
+					);
+
 				virtual void set(
 					__in const std::string &input,
 					__in_opt bool is_file = false
 					);
 
+				void set_hash_consing(
+					__in bool enabled
+					);
+
 				virtual size_t size(void);
 
 				virtual std::string to_string(
@@ -94,212 +122,257 @@ namespace LUNA_NS {
 			protected:
 
 				size_t add_child_node(
-					__in statement_t &stmt,
-					__in const uuid &token_id,
+					__in node_list_t &stmt,
+					__in size_t token,
 					__in_opt size_t parent = PARENT_NODE_NONE
 					);
 				
 				size_t add_control_node(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in token_t type,
 					__in_opt size_t parent = PARENT_NODE_NONE
 					);
 
-				statement_t &add_control_node(
-					__in token_t type,
-					__in_opt size_t position = 0
+				void add_statement(
+					__in const node_list_t &stmt,
+					__in size_t position
 					);
 
-				void add_root_node(
-					__in const uuid &node_id,
-					__in size_t position
+				size_t create_control_token(
+					__in token_t type
 					);
 
-				uuid create_node(
-					__in const uuid &token_id,
-					__in_opt size_t parent = PARENT_NODE_NONE,
-					__in_opt const std::vector<size_t> &children = std::vector<size_t>()
+				node_rec_t create_node(
+					__in size_t token,
+					__in_opt size_t parent = PARENT_NODE_NONE
 					);
 
 				size_t enumerate_assignment(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_assignment_list(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_call(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_conditional_else(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_conditional_if(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_condition_list(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_conditional_statement(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_conditional_while(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_control(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_array_list(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_compound(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_function(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_list(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_0p(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_1(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_1p(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_2(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_2p(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_3(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_3p(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_4(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_4p(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_5(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_5p(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_numeric_6(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_string(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_expression_struct(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_identifier_list(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_identifier_reference(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
 				size_t enumerate_statement(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0,
 					__in_opt bool root = false
 					);
 
 				size_t enumerate_statement_list(
-					__in statement_t &stmt,
+					__in node_list_t &stmt,
 					__in_opt size_t parent = 0
 					);
 
-				node_factory_ptr get_node_factory(void);
+				node_arena_ptr get_node_arena(void);
+
+				uint64_t hash_token(
+					__in size_t token
+					);
+
+				bool is_equal_subtree(
+					__in const node_list_t &stmt,
+					__in size_t position,
+					__in size_t index
+					);
+
+				bool is_equal_token(
+					__in size_t left,
+					__in size_t right
+					);
+
+				bool is_shareable_token(
+					__in size_t token
+					);
+
+				void register_subtrees(void);
+
+				void share_subtrees(
+					__in node_list_t &stmt
+					);
 
 				std::string statement_as_string(
 					__in const statement_t &stmt,
 					__in_opt bool verbose = false
 					);
 
-				std::vector<uuid> m_control_token_list;
+				context_shared_t m_context;
+
+				std::map<token_t, size_t> m_control_token_map;
+
+				bool m_hash_consing;
+
+				hash_cons_stats_t m_hash_cons_stats;
+
+				std::vector<uint32_t> m_share_child_list;
+
+				std::vector<uint32_t> m_share_child_offset;
+
+				std::vector<uint64_t> m_share_hash;
+
+				node_list_t m_share_list;
+
+				std::vector<std::pair<size_t, uint64_t>> m_share_pending;
+
+				std::vector<uint32_t> m_share_size;
+
+				std::vector<uint8_t> m_share_state;
 
 				std::vector<statement_t> m_statement_list;
 
 				size_t m_statement_position;
 
+				node_list_t m_statement_scratch;
+
 			private:
 
 				std::recursive_mutex m_lock;
@@ -0,0 +1,482 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "luna.h"
+#include "luna_resolver_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_LANG_NS {
+
+		_resolver::_resolver(void) :
+			m_binding_count(0)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_resolver::_resolver(
+			__in const _resolver &other
+			) :
+				m_binding_list(other.m_binding_list),
+				m_binding_count(other.m_binding_count),
+				m_frame_list(other.m_frame_list),
+				m_frame_map(other.m_frame_map)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_resolver::~_resolver(void)
+		{
+			TRACE_ENTRY();
+
+			resolver::clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_resolver &
+		_resolver::operator=(
+			__in const _resolver &other
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(this != &other) {
+				resolver::clear();
+				m_binding_list = other.m_binding_list;
+				m_binding_count = other.m_binding_count;
+				m_frame_list = other.m_frame_list;
+				m_frame_map = other.m_frame_map;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", this);
+			return *this;
+		}
+
+		void 
+		_resolver::bind(
+			__in size_t node,
+			__in atom_t key,
+			__in bool declare_local
+			)
+		{
+			size_t iter;
+			binding_t entry;
+			std::unordered_map<atom_t, uint32_t>::iterator slot_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			entry.slot = BINDING_SLOT_NONE;
+
+			for(iter = m_scope_stack.size(); iter > 0; --iter) {
+				resolver_scope_t &scop = m_scope_stack[iter - 1];
+
+				slot_iter = scop.slot_map.find(key);
+				if(slot_iter != scop.slot_map.end()) {
+					entry.depth = (m_scope_stack.size() - iter);
+					entry.slot = slot_iter->second;
+					entry.frame = scop.frame;
+
+					if(entry.depth && (entry.frame != RESOLVER_FRAME_GLOBAL)) {
+						entry.depth = BINDING_DEPTH_DYNAMIC;
+					}
+					break;
+				}
+			}
+
+			if(entry.slot == BINDING_SLOT_NONE) {
+				resolver_scope_t &scop = declare_local ? m_scope_stack.back() : m_scope_stack.front();
+
+				entry.depth = declare_local ? 0 : (m_scope_stack.size() - 1);
+				entry.slot = declare(scop, key);
+				entry.frame = scop.frame;
+			}
+
+			binding_t &bound = m_binding_list.at(node);
+			if(bound.slot == BINDING_SLOT_NONE) {
+				bound = entry;
+				++m_binding_count;
+			} else if((bound.depth != entry.depth) || (bound.slot != entry.slot) 
+					|| (bound.frame != entry.frame)) {
+				bound.depth = BINDING_DEPTH_DYNAMIC;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_resolver::clear(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_binding_list.clear();
+			m_binding_count = 0;
+			m_frame_list.clear();
+			m_frame_map.clear();
+			m_scope_stack.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		uint32_t 
+		_resolver::declare(
+			__in resolver_scope_t &scop,
+			__in atom_t key
+			)
+		{
+			uint32_t result;
+			std::unordered_map<atom_t, uint32_t>::iterator slot_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			slot_iter = scop.slot_map.find(key);
+			if(slot_iter == scop.slot_map.end()) {
+				result = scop.slot_map.size();
+				scop.slot_map.insert(std::pair<atom_t, uint32_t>(key, result));
+				m_frame_list.at(scop.frame).size = scop.slot_map.size();
+			} else {
+				result = slot_iter->second;
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_resolver::enter_frame(
+			__in size_t owner,
+			__in size_t depth,
+			__in size_t parent
+			)
+		{
+			frame_info_t info;
+			resolver_scope_t scop;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			info.owner = owner;
+			info.parent = m_scope_stack.empty() ? NODE_RECORD_NONE : m_scope_stack.back().frame;
+			info.size = 0;
+			scop.frame = m_frame_list.size();
+			scop.depth = depth;
+			scop.parent = parent;
+			scop.pending = (owner != NODE_RECORD_NONE);
+			m_frame_list.push_back(info);
+
+			if(owner != NODE_RECORD_NONE) {
+				m_frame_map.insert(std::pair<size_t, size_t>(owner, scop.frame));
+			}
+
+			m_scope_stack.push_back(scop);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		binding_t &
+		_resolver::get_binding(
+			__in size_t node
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(node >= m_binding_list.size()) {
+				THROW_LUNA_RESOLVER_EXCEPTION_MESSAGE(LUNA_RESOLVER_EXCEPTION_INVALID_NODE_POSITION,
+					"pos/max: %lu/%lu", node, m_binding_list.size());
+			}
+
+			binding_t &result = m_binding_list[node];
+			if(result.slot == BINDING_SLOT_NONE) {
+				THROW_LUNA_RESOLVER_EXCEPTION_MESSAGE(LUNA_RESOLVER_EXCEPTION_NODE_NOT_BOUND,
+					"pos: %lu", node);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result;
+		}
+
+		frame_info_t &
+		_resolver::get_frame(
+			__in size_t frame
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(frame >= m_frame_list.size()) {
+				THROW_LUNA_RESOLVER_EXCEPTION_MESSAGE(LUNA_RESOLVER_EXCEPTION_INVALID_FRAME,
+					"pos/max: %lu/%lu", frame, m_frame_list.size());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return m_frame_list[frame];
+		}
+
+		size_t 
+		_resolver::get_frame_count(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_frame_list.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_resolver::get_frame_index(
+			__in size_t owner
+			)
+		{
+			std::unordered_map<size_t, size_t>::iterator frame_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			frame_iter = m_frame_map.find(owner);
+			if(frame_iter == m_frame_map.end()) {
+				THROW_LUNA_RESOLVER_EXCEPTION_MESSAGE(LUNA_RESOLVER_EXCEPTION_INVALID_FRAME,
+					"owner: %lu", owner);
+			}
+
+			TRACE_EXIT("Return Value: %lu", frame_iter->second);
+			return frame_iter->second;
+		}
+
+		bool 
+		_resolver::has_binding(
+			__in size_t node
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = ((node < m_binding_list.size()) 
+				&& (m_binding_list[node].slot != BINDING_SLOT_NONE));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_resolver::has_frame(
+			__in size_t owner
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_frame_map.find(owner) != m_frame_map.end());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_resolver::resolve(
+			__in node_arena_ptr arena,
+			__in token_table &tok_table,
+			__in const std::vector<statement_t> &stmt_list
+			)
+		{
+			token_t type;
+			binding_t entry;
+			size_t depth, position;
+			std::vector<statement_t>::const_iterator stmt_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!arena) {
+				THROW_LUNA_RESOLVER_EXCEPTION(LUNA_RESOLVER_EXCEPTION_ALLOC_FAILED);
+			}
+
+			resolver::clear();
+			entry.depth = 0;
+			entry.slot = BINDING_SLOT_NONE;
+			entry.frame = RESOLVER_FRAME_GLOBAL;
+			m_binding_list.assign(arena->size(), entry);
+			enter_frame(NODE_RECORD_NONE, 0, NODE_RECORD_NONE);
+
+			for(stmt_iter = stmt_list.begin(); stmt_iter != stmt_list.end(); ++stmt_iter) {
+
+				if(!stmt_iter->second
+						|| (tok_table.get_type(arena->get_node(stmt_iter->first).token) != TOKEN_STATEMENT)) {
+					continue;
+				}
+
+				node_iterator node_iter(arena, stmt_iter->first);
+
+				for(;;) {
+					depth = node_iter.get_depth();
+					position = node_iter.get_position();
+					node_rec_t &nd = node_iter.get_node();
+					type = (token_t) tok_table.get_type(nd.token);
+
+					while((m_scope_stack.size() > 1) && (depth <= m_scope_stack.back().depth)) {
+						resolver_scope_t &scop = m_scope_stack.back();
+
+						if(scop.pending && (depth == scop.depth) && (nd.parent == scop.parent)
+								&& (type == TOKEN_STATEMENT_LIST)) {
+							scop.pending = false;
+							break;
+						}
+
+						m_scope_stack.pop_back();
+					}
+
+					switch(type) {
+						case TOKEN_IDENTIFIER:
+
+							if((nd.parent == NODE_RECORD_NONE)
+									|| (tok_table.get_atom(nd.token) == ATOM_INVALID)) {
+								break;
+							}
+
+							switch(tok_table.get_type(arena->get_node(nd.parent).token)) {
+								case TOKEN_ASSIGNMENT_LIST:
+								case TOKEN_IDENTIFIER:
+									break;
+								case TOKEN_IDENTIFIER_LIST:
+									declare(m_scope_stack.back(), tok_table.get_atom(nd.token));
+									bind(position, tok_table.get_atom(nd.token), true);
+									break;
+								case TOKEN_STATEMENT:
+									bind(position, tok_table.get_atom(nd.token), !nd.count 
+										&& (arena->get_node(nd.parent).count > 1)
+										&& (tok_table.get_type(arena->get_node(arena->get_child(nd.parent, 1)).token) 
+											== TOKEN_ASSIGNMENT));
+									break;
+								default:
+									bind(position, tok_table.get_atom(nd.token), false);
+									break;
+							}
+							break;
+						case TOKEN_KEYWORD:
+
+							if(tok_table.get_subtype(nd.token) == KEYWORD_FUNCT) {
+								enter_frame(position, depth, nd.parent);
+							}
+							break;
+						default:
+							break;
+					}
+
+					if(!node_iter.has_next()) {
+						break;
+					}
+
+					node_iter.move_next();
+				}
+
+				m_scope_stack.resize(1);
+			}
+
+			m_scope_stack.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_resolver::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_binding_count;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_resolver::to_string(
+			__in_opt bool verbose
+			)
+		{
+			size_t iter;
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Frames: " << m_frame_list.size() << ", Bindings: " << m_binding_count;
+
+			if(verbose) {
+
+				for(iter = 0; iter < m_frame_list.size(); ++iter) {
+					result << std::endl << "[" << iter << "] Owner: ";
+
+					if(m_frame_list[iter].owner == NODE_RECORD_NONE) {
+						result << NONE;
+					} else {
+						result << m_frame_list[iter].owner;
+					}
+
+					result << ", Parent: ";
+
+					if(m_frame_list[iter].parent == NODE_RECORD_NONE) {
+						result << NONE;
+					} else {
+						result << m_frame_list[iter].parent;
+					}
+
+					result << ", Slots: " << m_frame_list[iter].size;
+				}
+
+				for(iter = 0; iter < m_binding_list.size(); ++iter) {
+
+					if(m_binding_list[iter].slot == BINDING_SLOT_NONE) {
+						continue;
+					}
+
+					result << std::endl << "{" << iter << "} Depth: ";
+
+					if(m_binding_list[iter].depth == BINDING_DEPTH_DYNAMIC) {
+						result << "DYNAMIC";
+					} else {
+						result << m_binding_list[iter].depth;
+					}
+
+					result << ", Slot: " << m_binding_list[iter].slot << ", Frame: " 
+						<< m_binding_list[iter].frame;
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+	}
+}
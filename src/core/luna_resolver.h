@@ -0,0 +1,144 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_RESOLVER_H_
+#define LUNA_RESOLVER_H_
+
+#include <unordered_map>
+
+namespace LUNA_NS {
+
+	using namespace LUNA_COMP_NS;
+
+	namespace LUNA_LANG_NS {
+
+		#define BINDING_DEPTH_DYNAMIC ((uint32_t) INVALID)
+		#define BINDING_SLOT_NONE ((uint32_t) INVALID)
+		#define RESOLVER_FRAME_GLOBAL 0
+
+		typedef struct {
+			uint32_t depth;
+			uint32_t slot;
+			uint32_t frame;
+		} binding_t, *binding_ptr_t;
+
+		typedef struct {
+			size_t owner;
+			size_t parent;
+			size_t size;
+		} frame_info_t, *frame_info_ptr_t;
+
+		typedef struct {
+			size_t frame;
+			size_t depth;
+			size_t parent;
+			bool pending;
+			std::unordered_map<atom_t, uint32_t> slot_map;
+		} resolver_scope_t, *resolver_scope_ptr_t;
+
+		typedef class _resolver {
+
+			public:
+
+				_resolver(void);
+
+				_resolver(
+					__in const _resolver &other
+					);
+
+				virtual ~_resolver(void);
+
+				_resolver &operator=(
+					__in const _resolver &other
+					);
+
+				void clear(void);
+
+				binding_t &get_binding(
+					__in size_t node
+					);
+
+				frame_info_t &get_frame(
+					__in size_t frame
+					);
+
+				size_t get_frame_count(void);
+
+				size_t get_frame_index(
+					__in size_t owner
+					);
+
+				bool has_binding(
+					__in size_t node
+					);
+
+				bool has_frame(
+					__in size_t owner
+					);
+
+				void resolve(
+					__in node_arena_ptr arena,
+					__in token_table &tok_table,
+					__in const std::vector<statement_t> &stmt_list
+					);
+
+				size_t size(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				void bind(
+					__in size_t node,
+					__in atom_t key,
+					__in bool declare_local
+					);
+
+				uint32_t declare(
+					__in resolver_scope_t &scop,
+					__in atom_t key
+					);
+
+				void enter_frame(
+					__in size_t owner,
+					__in size_t depth,
+					__in size_t parent
+					);
+
+				std::vector<binding_t> m_binding_list;
+
+				size_t m_binding_count;
+
+				std::vector<frame_info_t> m_frame_list;
+
+				std::unordered_map<size_t, size_t> m_frame_map;
+
+				std::vector<resolver_scope_t> m_scope_stack;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} resolver, *resolver_ptr;
+	}
+}
+
+#endif // LUNA_RESOLVER_H_
@@ -0,0 +1,55 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_RESOLVER_TYPE_H_
+#define LUNA_RESOLVER_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_LANG_NS {
+
+		enum {
+			LUNA_RESOLVER_EXCEPTION_ALLOC_FAILED = 0,
+			LUNA_RESOLVER_EXCEPTION_INVALID_FRAME,
+			LUNA_RESOLVER_EXCEPTION_INVALID_NODE_POSITION,
+			LUNA_RESOLVER_EXCEPTION_NODE_NOT_BOUND,
+		};
+
+		static const std::string LUNA_RESOLVER_EXCEPTION_STR[] = {
+			"Resolver node arena allocation failed",
+			"Invalid resolver frame",
+			"Invalid resolver node position",
+			"Resolver node is not bound",
+			};
+
+		#define LUNA_RESOLVER_EXCEPTION_MAX LUNA_RESOLVER_EXCEPTION_NODE_NOT_BOUND
+
+		#define LUNA_RESOLVER_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_RESOLVER_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_RESOLVER_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_RESOLVER_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_RESOLVER_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_RESOLVER_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_RESOLVER_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _resolver;
+		typedef _resolver resolver, *resolver_ptr;
+	}
+}
+
+#endif // LUNA_RESOLVER_TYPE_H_
@@ -26,12 +26,23 @@ namespace LUNA_NS {
 		
 		static const std::string SCOPE_SYMBOL_STR[] = {
 			"ARRAY", "BOOLEAN", "FLOAT", "FUNCTION", "IDENTIFIER", "INTEGER",
-			"NULL", "STRUCTURE",
+			"LITERAL_STRING", "NULL", "STRUCTURE",
 			};
 
 		#define SCOPE_SYMBOL_STRING(_TYPE_)\
 			((_TYPE_) > SCOPE_SYMBOL_MAX ? UNKNOWN : SCOPE_SYMBOL_STR[_TYPE_].c_str())
 
+		static const std::string SYMBOL_ARRAY_STORE_STR[] = {
+			"BOOLEAN", "BOXED", "EMPTY", "FLOAT", "INTEGER",
+			};
+
+		#define SYMBOL_ARRAY_STORE_STRING(_TYPE_)\
+			((_TYPE_) > SYMBOL_ARRAY_STORE_MAX ? UNKNOWN : SYMBOL_ARRAY_STORE_STR[_TYPE_].c_str())
+
+		#define SCOPE_TABLE_HASH(_KEY_) ((size_t) ((uint32_t) (_KEY_) * 0x9e3779b1))
+		#define SCOPE_TABLE_LOAD_DENOMINATOR 4
+		#define SCOPE_TABLE_LOAD_NUMERATOR 3
+
 		_scope_factory *_scope_factory::m_instance = NULL;
 
 		void 
@@ -52,6 +63,8 @@ namespace LUNA_NS {
 			__in const std::string &key,
 			__in scope_sym_t type
 			) :
+				m_frozen(false),
+				m_key(ATOM_INVALID),
 				m_parent(parent)
 		{
 			TRACE_ENTRY();
@@ -66,6 +79,7 @@ namespace LUNA_NS {
 			__in const _symbol &other
 			) :
 				uuid_base(other),
+				m_frozen(false),
 				m_key(other.m_key),
 				m_parent(other.m_parent),
 				m_type(other.m_type)
@@ -89,6 +103,7 @@ namespace LUNA_NS {
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
+				symbol::check_writable();
 				uuid_base::operator=(other);
 				m_key = other.m_key;
 				m_parent = other.m_parent;
@@ -99,12 +114,46 @@ namespace LUNA_NS {
 			return *this;
 		}
 
-		std::string &
+		void 
+		_symbol::check_writable(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_frozen) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN,
+					"%s", symbol::get_key().c_str());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_symbol::freeze(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_frozen = true;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		const std::string &
 		_symbol::get_key(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return atom_factory::acquire()->get_text(m_key);
+		}
+
+		atom_t 
+		_symbol::get_key_atom(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", m_key);
 			return m_key;
 		}
 
@@ -117,6 +166,40 @@ namespace LUNA_NS {
 			return m_type;
 		}
 
+		bool 
+		_symbol::is_frozen(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_frozen;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_symbol::set_key(
+			__in atom_t key
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			symbol::check_writable();
+
+			if(!atom_factory::acquire()->has_atom(key)) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_KEY,
+					"0x%x", key);
+			}
+
+			m_key = key;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
 		void 
 		_symbol::set_key(
 			__in const std::string &key
@@ -125,12 +208,27 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			if(key.empty()) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_KEY,
 					"\'%s\' (%lu)", key.c_str(), key.size());
 			}
 
-			m_key = key;
+			m_key = atom_factory::acquire()->generate(key);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_symbol::set_parent(
+			__in _scope *parent
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_parent = parent;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -143,6 +241,8 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			if(type > SCOPE_SYMBOL_MAX) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_TYPE,
 					"%lu", type);
@@ -167,7 +267,7 @@ namespace LUNA_NS {
 				result << uuid_base::to_string() << " ";
 			}	
 
-			result << "[" << SCOPE_SYMBOL_STRING(m_type) << "] \'" << m_key << "\'";
+			result << "[" << SCOPE_SYMBOL_STRING(m_type) << "] \'" << symbol::get_key() << "\'";
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
@@ -177,9 +277,13 @@ namespace LUNA_NS {
 			__in _scope *parent,
 			__in const std::string &key	
 			) :
-				symbol(parent, key, SCOPE_SYMBOL_ARRAY)
+				symbol(parent, key, SCOPE_SYMBOL_ARRAY),
+				m_store(new array_store_data_t)
 		{
 			TRACE_ENTRY();
+
+			m_store->type = SYMBOL_ARRAY_STORE_EMPTY;
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
@@ -187,7 +291,7 @@ namespace LUNA_NS {
 			__in _symbol_array &other
 			) :
 				symbol(other),
-				m_value(other.m_value)
+				m_store(other.m_store)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -209,7 +313,7 @@ namespace LUNA_NS {
 
 			if(this != &other) {
 				symbol::operator=(other);
-				m_value = other.m_value;
+				m_store = other.m_store;
 			}
 
 			TRACE_EXIT("Return Value: 0x%p", this);
@@ -217,226 +321,588 @@ namespace LUNA_NS {
 		}
 
 		void 
-		_symbol_array::add_value(
-			__in const uuid &value
+		_symbol_array::add_element(
+			__in const _value &element
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_value.push_back(value);
+			prepare_store(element);
+
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					m_store->boolean.push_back(element.as_boolean() ? 1 : 0);
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					m_store->floating.push_back(element.as_float());
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					m_store->integer.push_back(element.as_integer());
+					break;
+				default:
+					m_store->boxed.push_back(element.is_reference() ? _value() : element);
+					m_store->reference.push_back(element.is_reference() ? element.as_reference()->get_id() : uuid());
+					break;
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_symbol_array::clear(void)
+		_symbol_array::add_value(
+			__in const uuid &value
+			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_value.clear();
+			add_element(_value(resolve_reference(value)));
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		uuid 
-		_symbol_array::get_value(
-			__in size_t index
-			)
+		void 
+		_symbol_array::box_store(void)
 		{
+			size_t iter;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(index >= m_value.size()) {
-				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
-					"ind/max: %lu/%lu", index, m_value.size() - 1);
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+
+					for(iter = 0; iter < m_store->boolean.size(); ++iter) {
+						m_store->boxed.push_back(_value(m_store->boolean.at(iter) != 0));
+					}
+
+					std::vector<uint8_t>().swap(m_store->boolean);
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+
+					for(iter = 0; iter < m_store->floating.size(); ++iter) {
+						m_store->boxed.push_back(_value(m_store->floating.at(iter)));
+					}
+
+					std::vector<double>().swap(m_store->floating);
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+
+					for(iter = 0; iter < m_store->integer.size(); ++iter) {
+						m_store->boxed.push_back(_value((int) m_store->integer.at(iter)));
+					}
+
+					std::vector<int32_t>().swap(m_store->integer);
+					break;
+				default:
+					break;
 			}
 
+			m_store->reference.resize(m_store->boxed.size(), uuid());
+			m_store->type = SYMBOL_ARRAY_STORE_BOXED;
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return m_value.at(index);
 		}
 
 		void 
-		_symbol_array::insert_value(
-			__in const uuid &value,
-			__in size_t index
-			)
+		_symbol_array::clear(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(index > m_value.size()) {
-				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
-					"ind/max: %lu/%lu", index, m_value.size());
-			} else if(index < m_value.size()) {
-				m_value.insert(m_value.begin() + index, value);
-			} else {
-				m_value.push_back(value);
-			}
+			symbol::check_writable();
+
+			m_store = array_store_shared_t(new array_store_data_t);
+			m_store->type = SYMBOL_ARRAY_STORE_EMPTY;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_symbol_array::remove_value(
-			__in size_t index
-			)
+		_symbol_array::detach(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(index >= m_value.size()) {
-				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
-					"ind/max: %lu/%lu", index, m_value.size() - 1);
-			}
+			symbol::check_writable();
 
-			m_value.erase(m_value.begin() + index);
+			if(m_store.use_count() > 1) {
+				m_store = array_store_shared_t(new array_store_data_t(*m_store));
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		void 
-		_symbol_array::set_value(
-			__in const uuid &value,
+		_value 
+		_symbol_array::get_element(
 			__in size_t index
 			)
 		{
+			_value result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(index >= m_value.size()) {
+			if(index >= symbol_array::size()) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
-					"ind/max: %lu/%lu", index, m_value.size() - 1);
+					"ind/max: %lu/%lu", index, symbol_array::size() - 1);
+			}
+
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					result = _value(m_store->boolean[index] != 0);
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					result = _value(m_store->floating[index]);
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					result = _value((int) m_store->integer[index]);
+					break;
+				default:
+
+					if(m_store->reference[index] != uuid()) {
+						result = _value(resolve_reference(m_store->reference[index]));
+					} else {
+						result = m_store->boxed[index];
+					}
+					break;
 			}
 
-			m_value.at(index) = value;
+			TRACE_EXIT("Return Value: 0x%llx", result.get_bits());
+			return result;
+		}
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+		array_store_t 
+		_symbol_array::get_store(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %s", SYMBOL_ARRAY_STORE_STRING(m_store->type));
+			return m_store->type;
 		}
 
 		size_t 
-		_symbol_array::size(void)
+		_symbol_array::get_store_size(void)
 		{
 			size_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = m_value.size();
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					result = (m_store->boolean.capacity() * sizeof(uint8_t));
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					result = (m_store->floating.capacity() * sizeof(double));
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					result = (m_store->integer.capacity() * sizeof(int32_t));
+					break;
+				default:
+					result = ((m_store->boxed.capacity() * sizeof(_value)) 
+						+ (m_store->reference.capacity() * sizeof(uuid)));
+					break;
+			}
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
-		std::string 
-		_symbol_array::to_string(
-			__in_opt bool verbose
+		uuid 
+		_symbol_array::get_value(
+			__in size_t index
 			)
 		{
-			std::stringstream result;
-			std::vector<uuid>::iterator sym_iter;
-
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result << symbol::to_string(verbose) << ", Entries: " << m_value.size();
-
-			for(sym_iter = m_value.begin(); sym_iter != m_value.end(); ++sym_iter) {
-				result << std::endl << "--- " << (m_parent ? scope::symbol_as_string(m_parent->get_symbol(*sym_iter))
-					: sym_iter->to_string());
+			if(!is_reference(index)) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_TYPE,
+					"%s", SYMBOL_ARRAY_STORE_STRING(m_store->type));
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return result.str();
+			return m_store->reference[index];
 		}
 
-		_symbol_boolean::_symbol_boolean(
-			__in _scope *parent,
-			__in const std::string &key,
-			__in_opt bool value
-			) :
-				symbol(parent, key, SCOPE_SYMBOL_BOOLEAN),
-				m_value(value)
+		void 
+		_symbol_array::insert_element(
+			__in const _value &element,
+			__in size_t index
+			)
 		{
 			TRACE_ENTRY();
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-		}
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(index > symbol_array::size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"ind/max: %lu/%lu", index, symbol_array::size());
+			}
+
+			prepare_store(element);
+
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					m_store->boolean.insert(m_store->boolean.begin() + index, element.as_boolean() ? 1 : 0);
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					m_store->floating.insert(m_store->floating.begin() + index, element.as_float());
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					m_store->integer.insert(m_store->integer.begin() + index, element.as_integer());
+					break;
+				default:
+					m_store->boxed.insert(m_store->boxed.begin() + index, element.is_reference() ? _value() : element);
+					m_store->reference.insert(m_store->reference.begin() + index, 
+						element.is_reference() ? element.as_reference()->get_id() : uuid());
+					break;
+			}
+
+			if(heap::is_marking()) {
+				heap::acquire()->scan_barrier(this);
+			}
 
-		_symbol_boolean::_symbol_boolean(
-			__in _symbol_boolean &other
-			) :
-				symbol(other),
-				m_value(other.m_value)
-		{
-			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		_symbol_boolean::~_symbol_boolean(void)
+		void 
+		_symbol_array::insert_value(
+			__in const uuid &value,
+			__in size_t index
+			)
 		{
 			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			insert_element(_value(resolve_reference(value)), index);
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		_symbol_boolean &
-		_symbol_boolean::operator=(
-			__in _symbol_boolean &other
+		bool 
+		_symbol_array::is_reference(
+			__in size_t index
 			)
 		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(this != &other) {
-				symbol::operator=(other);
-				m_value = other.m_value;
+			if(index >= symbol_array::size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"ind/max: %lu/%lu", index, symbol_array::size() - 1);
 			}
 
-			TRACE_EXIT("Return Value: 0x%p", this);
-			return *this;
+			result = ((m_store->type == SYMBOL_ARRAY_STORE_BOXED) 
+					&& (m_store->reference[index] != uuid()));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		bool 
-		_symbol_boolean::get_value(void)
+		_symbol_array::is_shared(void)
 		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return m_value;
+
+			result = (m_store.use_count() > 1);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		void 
-		_symbol_boolean::set_value(
-			__in bool value
+		_symbol_array::prepare_store(
+			__in const _value &element
 			)
 		{
+			array_store_t store;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_value = value;
+			detach();
+
+			switch(element.get_tag()) {
+				case VALUE_TAG_BOOLEAN:
+					store = SYMBOL_ARRAY_STORE_BOOLEAN;
+					break;
+				case VALUE_TAG_FLOAT:
+					store = SYMBOL_ARRAY_STORE_FLOAT;
+					break;
+				case VALUE_TAG_INTEGER:
+					store = SYMBOL_ARRAY_STORE_INTEGER;
+					break;
+				default:
+					store = SYMBOL_ARRAY_STORE_BOXED;
+					break;
+			}
+
+			if(m_store->type == SYMBOL_ARRAY_STORE_EMPTY) {
+				m_store->type = store;
+			} else if((m_store->type != SYMBOL_ARRAY_STORE_BOXED) 
+					&& (m_store->type != store)) {
+				box_store();
+			}
+
+			if(element.is_reference() && heap::is_marking()) {
+				heap::acquire()->write_barrier(element.as_reference());
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		std::string 
-		_symbol_boolean::to_string(
-			__in_opt bool verbose
+		void 
+		_symbol_array::remove_value(
+			__in size_t index
 			)
 		{
-			std::stringstream result;
-
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result << symbol::to_string(verbose) << ", Value: " 
-				<< (m_value ? "TRUE" : "FALSE");
+			if(index >= symbol_array::size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"ind/max: %lu/%lu", index, symbol_array::size() - 1);
+			}
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return result.str();
-		}
+			detach();
 
-		_symbol_float::_symbol_float(
-			__in _scope *parent,
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					m_store->boolean.erase(m_store->boolean.begin() + index);
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					m_store->floating.erase(m_store->floating.begin() + index);
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					m_store->integer.erase(m_store->integer.begin() + index);
+					break;
+				default:
+					m_store->boxed.erase(m_store->boxed.begin() + index);
+					m_store->reference.erase(m_store->reference.begin() + index);
+					break;
+			}
+
+			if(heap::is_marking()) {
+				heap::acquire()->scan_barrier(this);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		symbol_ptr 
+		_symbol_array::resolve_reference(
+			__in const uuid &id
+			)
+		{
+			symbol_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_parent && m_parent->has_symbol(id)) {
+				result = m_parent->get_symbol(id);
+			} else {
+				result = heap::acquire()->get_object(id);
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_symbol_array::set_element(
+			__in const _value &element,
+			__in size_t index
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(index >= symbol_array::size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"ind/max: %lu/%lu", index, symbol_array::size() - 1);
+			}
+
+			prepare_store(element);
+
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					m_store->boolean[index] = (element.as_boolean() ? 1 : 0);
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					m_store->floating[index] = element.as_float();
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					m_store->integer[index] = element.as_integer();
+					break;
+				default:
+					m_store->boxed[index] = (element.is_reference() ? _value() : element);
+					m_store->reference[index] = (element.is_reference() ? element.as_reference()->get_id() : uuid());
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_symbol_array::set_value(
+			__in const uuid &value,
+			__in size_t index
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			set_element(_value(resolve_reference(value)), index);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_symbol_array::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			switch(m_store->type) {
+				case SYMBOL_ARRAY_STORE_BOOLEAN:
+					result = m_store->boolean.size();
+					break;
+				case SYMBOL_ARRAY_STORE_FLOAT:
+					result = m_store->floating.size();
+					break;
+				case SYMBOL_ARRAY_STORE_INTEGER:
+					result = m_store->integer.size();
+					break;
+				default:
+					result = m_store->boxed.size();
+					break;
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_symbol_array::to_string(
+			__in_opt bool verbose
+			)
+		{
+			size_t iter, count;
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			count = symbol_array::size();
+			result << symbol::to_string(verbose) << ", Store: " << SYMBOL_ARRAY_STORE_STRING(m_store->type) 
+				<< ", Entries: " << count;
+
+			for(iter = 0; iter < count; ++iter) {
+				result << std::endl << "--- " << get_element(iter).to_string(verbose);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		_symbol_boolean::_symbol_boolean(
+			__in _scope *parent,
+			__in const std::string &key,
+			__in_opt bool value
+			) :
+				symbol(parent, key, SCOPE_SYMBOL_BOOLEAN),
+				m_value(value)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_symbol_boolean::_symbol_boolean(
+			__in _symbol_boolean &other
+			) :
+				symbol(other),
+				m_value(other.m_value)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_symbol_boolean::~_symbol_boolean(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_symbol_boolean &
+		_symbol_boolean::operator=(
+			__in _symbol_boolean &other
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(this != &other) {
+				symbol::operator=(other);
+				m_value = other.m_value;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", this);
+			return *this;
+		}
+
+		bool 
+		_symbol_boolean::get_value(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return m_value;
+		}
+
+		void 
+		_symbol_boolean::set_value(
+			__in bool value
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			symbol::check_writable();
+
+			m_value = value;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		std::string 
+		_symbol_boolean::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << symbol::to_string(verbose) << ", Value: " 
+				<< (m_value ? "TRUE" : "FALSE");
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		_symbol_float::_symbol_float(
+			__in _scope *parent,
 			__in const std::string &key,
 			__in_opt double value
 			) :
@@ -497,6 +963,8 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			m_value = value;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -569,6 +1037,8 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			m_parameter.clear();
 			m_statement.clear();
 
@@ -589,6 +1059,23 @@ namespace LUNA_NS {
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return atom_factory::acquire()->get_text(m_parameter.at(index));
+		}
+
+		atom_t 
+		_symbol_function::get_paramter_atom(
+			__in size_t index
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(index >= m_parameter.size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"ind/max: %lu/%lu", index, m_parameter.size() - 1);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", m_parameter.at(index));
 			return m_parameter.at(index);
 		}
 
@@ -639,17 +1126,43 @@ namespace LUNA_NS {
 
 		void 
 		_symbol_function::set_parameters(
-			__in const std::vector<std::string> &parameters
+			__in const std::vector<atom_t> &parameters
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			m_parameter = parameters;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		void 
+		_symbol_function::set_parameters(
+			__in const std::vector<std::string> &parameters
+			)
+		{
+			atom_factory_ptr atom_fact;
+			std::vector<std::string>::const_iterator param_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			symbol::check_writable();
+
+			atom_fact = atom_factory::acquire();
+			m_parameter.clear();
+			m_parameter.reserve(parameters.size());
+
+			for(param_iter = parameters.begin(); param_iter != parameters.end(); ++param_iter) {
+				m_parameter.push_back(atom_fact->generate(*param_iter));
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
 		void 
 		_symbol_function::set_statements(
 			__in const std::vector<uuid> &statements
@@ -658,6 +1171,8 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			m_statement = statements;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -670,7 +1185,7 @@ namespace LUNA_NS {
 		{
 			std::stringstream result;
 			std::vector<uuid>::iterator stmt_iter;
-			std::vector<std::string>::iterator param_iter;
+			std::vector<atom_t>::iterator param_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -683,7 +1198,7 @@ namespace LUNA_NS {
 					result << ", ";
 				}
 
-				result << *param_iter;
+				result << atom_factory::acquire()->get_text(*param_iter);
 			}
 
 			result << "}, Statements: " << m_statement.size();
@@ -758,6 +1273,8 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			m_value = value;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -841,6 +1358,8 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			symbol::check_writable();
+
 			m_value = value;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -868,7 +1387,7 @@ namespace LUNA_NS {
 			__in_opt const std::string &value
 			) :
 				symbol(parent, key, SCOPE_SYMBOL_LITERAL_STRING),
-				m_value(value)
+				m_value(new std::string(value))
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -906,13 +1425,27 @@ namespace LUNA_NS {
 			return *this;
 		}
 
-		std::string 
+		const std::string &
 		_symbol_literal_string::get_value(void)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return m_value;
+			return *m_value;
+		}
+
+		bool 
+		_symbol_literal_string::is_shared(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_value.use_count() > 1);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		void 
@@ -923,7 +1456,13 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_value = value;
+			symbol::check_writable();
+
+			if(m_value.use_count() > 1) {
+				m_value = literal_string_shared_t(new std::string(value));
+			} else {
+				*m_value = value;
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -938,7 +1477,7 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result << symbol::to_string(verbose) << ", Value: \"" << m_value << "\"";
+			result << symbol::to_string(verbose) << ", Value: \"" << *m_value << "\"";
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
@@ -1000,7 +1539,9 @@ namespace LUNA_NS {
 			__in _scope *parent,
 			__in const std::string &key
 			) :
-				symbol(parent, key, SCOPE_SYMBOL_STRUCTURE)
+				symbol(parent, key, SCOPE_SYMBOL_STRUCTURE),
+				m_shape(NULL),
+				m_slot(new std::vector<uuid>)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -1010,7 +1551,8 @@ namespace LUNA_NS {
 			__in _symbol_structure &other
 			) :
 				symbol(other),
-				m_value(other.m_value)
+				m_shape(other.m_shape),
+				m_slot(other.m_slot)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -1032,7 +1574,8 @@ namespace LUNA_NS {
 
 			if(this != &other) {
 				symbol::operator=(other);
-				m_value = other.m_value;
+				m_shape = other.m_shape;
+				m_slot = other.m_slot;
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", this);
@@ -1041,52 +1584,148 @@ namespace LUNA_NS {
 
 		void 
 		_symbol_structure::add_value(
-			__in const std::string &key,
+			__in atom_t key,
 			__in const uuid &value
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(m_value.find(key) != m_value.end()) {
+			if(m_shape && m_shape->has_field(key)) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_ALREADY_EXISTS,
-					"%s", key.c_str());
+					"0x%x", key);
 			}
 
-			m_value.insert(std::pair<std::string, uuid>(key, value));
+			detach();
+			m_shape = shape_factory::acquire()->get_transition(m_shape, key);
+			m_slot->push_back(value);
+
+			if(heap::is_marking()) {
+				heap::acquire()->write_barrier(value);
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_symbol_structure::clear(void)
+		_symbol_structure::add_value(
+			__in const std::string &key,
+			__in const uuid &value
+			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_value.clear();
+			add_value(atom_factory::acquire()->generate(key), value);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
-		
-		std::map<std::string, uuid>::iterator 
-		_symbol_structure::find_value(
-			__in const std::string &key
-			)
-		{
-			std::map<std::string, uuid>::iterator key_iter;
 
-			TRACE_ENTRY();
+		void 
+		_symbol_structure::clear(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			symbol::check_writable();
+
+			m_shape = NULL;
+			m_slot = structure_slot_shared_t(new std::vector<uuid>);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_symbol_structure::detach(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			symbol::check_writable();
+
+			if(m_slot.use_count() > 1) {
+				m_slot = structure_slot_shared_t(new std::vector<uuid>(*m_slot));
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_symbol_structure::find_slot(
+			__in atom_t key
+			)
+		{
+			size_t result = SHAPE_SLOT_NONE;
+
+			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			key_iter = m_value.find(key);
-			if(key_iter == m_value.end()) {
+			if(m_shape) {
+				result = m_shape->find_slot(key);
+			}
+
+			if(result == SHAPE_SLOT_NONE) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND,
-					"%s", key.c_str());
+					"0x%x", key);
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_symbol_structure::find_slot(
+			__in atom_t key,
+			__inout shape_cache_t &cache
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_shape && (cache.layout == m_shape)) {
+				result = cache.slot;
+			} else {
+				result = find_slot(key);
+				cache.layout = m_shape;
+				cache.slot = result;
 			}
 
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		shape_ptr 
+		_symbol_structure::get_shape(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", m_shape);
+			return m_shape;
+		}
+
+		uuid 
+		_symbol_structure::get_value(
+			__in atom_t key
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return (*m_slot)[find_slot(key)];
+		}
+
+		uuid 
+		_symbol_structure::get_value(
+			__in atom_t key,
+			__inout shape_cache_t &cache
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return key_iter;
+			return (*m_slot)[find_slot(key, cache)];
 		}
 
 		uuid 
@@ -1097,7 +1736,23 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_value(key)->second;
+			return (*m_slot)[find_slot(atom_factory::acquire()->find(key))];
+		}
+
+		bool 
+		_symbol_structure::has_value(
+			__in atom_t key
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_shape && m_shape->has_field(key));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		bool 
@@ -1110,7 +1765,21 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = (m_value.find(key) != m_value.end());
+			result = has_value(atom_factory::acquire()->find(key));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_symbol_structure::is_shared(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_slot.use_count() > 1);
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
@@ -1121,10 +1790,66 @@ namespace LUNA_NS {
 			__in const std::string &key
 			)
 		{
+			atom_t key_atom;
+			size_t slot;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			key_atom = atom_factory::acquire()->find(key);
+			slot = find_slot(key_atom);
+			detach();
+			m_shape = shape_factory::acquire()->remove_field(m_shape, key_atom);
+			m_slot->erase(m_slot->begin() + slot);
+
+			if(heap::is_marking()) {
+				heap::acquire()->scan_barrier(this);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_symbol_structure::set_value(
+			__in atom_t key,
+			__in const uuid &value
+			)
+		{
+			size_t slot;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			slot = find_slot(key);
+			detach();
+			(*m_slot)[slot] = value;
+
+			if(heap::is_marking()) {
+				heap::acquire()->write_barrier(value);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_symbol_structure::set_value(
+			__in atom_t key,
+			__in const uuid &value,
+			__inout shape_cache_t &cache
+			)
+		{
+			size_t slot;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_value.erase(find_value(key));
+			slot = find_slot(key, cache);
+			detach();
+			(*m_slot)[slot] = value;
+
+			if(heap::is_marking()) {
+				heap::acquire()->write_barrier(value);
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -1135,10 +1860,18 @@ namespace LUNA_NS {
 			__in const uuid &value
 			)
 		{
+			size_t slot;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			find_value(key)->second = value;
+			slot = find_slot(atom_factory::acquire()->find(key));
+			detach();
+			(*m_slot)[slot] = value;
+
+			if(heap::is_marking()) {
+				heap::acquire()->write_barrier(value);
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -1151,7 +1884,7 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = m_value.size();
+			result = m_slot->size();
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
@@ -1162,26 +1895,41 @@ namespace LUNA_NS {
 			__in_opt bool verbose
 			)
 		{
+			size_t iter;
 			std::stringstream result;
-			std::map<std::string, uuid>::iterator sym_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result << symbol::to_string(verbose) << ", Entries: " << m_value.size();
+			result << symbol::to_string(verbose) << ", Entries: " << m_slot->size();
 
-			for(sym_iter = m_value.begin(); sym_iter != m_value.end(); ++sym_iter) {
-				result << std::endl << "--- " << (m_parent ? scope::symbol_as_string(m_parent->get_symbol(sym_iter->second))
-					: sym_iter->second.to_string());
+			for(iter = 0; iter < m_slot->size(); ++iter) {
+				result << std::endl << "--- " << atom_factory::acquire()->get_text(m_shape->get_field(iter)) 
+					<< ": " << (m_parent ? scope::symbol_as_string(m_parent->get_symbol((*m_slot)[iter]))
+						: (*m_slot)[iter].to_string());
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
 		}
 
-		_scope::_scope(void)
+		_scope::_scope(void) :
+			m_frozen(false),
+			m_shadow_count(0),
+			m_sym_count(0),
+			m_sym_table(SCOPE_TABLE_CAPACITY)
 		{
+			std::vector<scope_slot_t>::iterator slot_iter;
+
 			TRACE_ENTRY();
+
+			for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
+				slot_iter->key = ATOM_INVALID;
+				slot_iter->sym = NULL;
+			}
+
+			scope::clear();
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
@@ -1189,8 +1937,13 @@ namespace LUNA_NS {
 			__in const _scope &other
 			) :
 				uuid_base(other),
-				m_sym_lookup_map(other.m_sym_lookup_map),
-				m_sym_map(other.m_sym_map)
+				m_base(other.m_base),
+				m_frame(other.m_frame),
+				m_frozen(other.m_frozen),
+				m_shadow_count(other.m_shadow_count),
+				m_sym_count(other.m_sym_count),
+				m_sym_id_map(other.m_sym_id_map),
+				m_sym_table(other.m_sym_table)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -1210,13 +1963,27 @@ namespace LUNA_NS {
 			__in const _scope &other
 			)
 		{
+			std::vector<scope_slot_t>::iterator slot_iter;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				uuid_base::operator=(other);
-				m_sym_lookup_map = other.m_sym_lookup_map;
-				m_sym_map = other.m_sym_map;
+				m_base = other.m_base;
+				m_frame = other.m_frame;
+				m_frozen = other.m_frozen;
+				m_shadow_count = other.m_shadow_count;
+				m_sym_count = other.m_sym_count;
+				m_sym_id_map = other.m_sym_id_map;
+				m_sym_table = other.m_sym_table;
+
+				if(heap::is_marking()) {
+
+					for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
+						heap::acquire()->root_barrier(slot_iter->sym);
+					}
+				}
 			}
 
 			TRACE_EXIT("Return Value: 0x%p", this);
@@ -1419,14 +2186,17 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_INVALID_SYMBOL);
 			}
 
-			if((m_sym_lookup_map.find(sym->get_key()) != m_sym_lookup_map.end())
-					|| (m_sym_map.find(sym->get_id()) != m_sym_map.end())) {
+			if(m_frozen) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN);
+			}
+
+			if((find_slot(sym->get_key_atom()) != SCOPE_SLOT_NONE)
+					|| (m_base && m_base->has_symbol(sym->get_key_atom()))) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_ALREADY_EXISTS,
 					"%s", sym->get_key().c_str());
 			}
 
-			m_sym_lookup_map.insert(std::pair<std::string, uuid>(sym->get_key(), sym->get_id()));
-			m_sym_map.insert(std::pair<uuid, symbol_ptr>(sym->get_id(), sym));
+			insert_symbol(sym);
 			
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return sym->get_id();
@@ -1483,156 +2253,777 @@ namespace LUNA_NS {
 		void 
 		_scope::clear(void)
 		{
-			std::map<uuid, symbol_ptr>::iterator sym_iter;
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			for(id_iter = m_sym_id_map.begin(); id_iter != m_sym_id_map.end(); ++id_iter) {
+				erase_slot(find_slot(id_iter->second->get_key_atom()));
+				delete id_iter->second;
+			}
+
+			m_base.reset();
+			m_frame.clear();
+			m_frozen = false;
+			m_shadow_count = 0;
+			m_sym_count = 0;
+			m_sym_id_map.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		symbol_ptr 
+		_scope::copy_symbol(
+			__in symbol_ptr sym
+			)
+		{
+			symbol_ptr result = NULL;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!sym) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_INVALID_SYMBOL);
+			}
+
+			switch(sym->get_type()) {
+				case SCOPE_SYMBOL_ARRAY:
+					result = new symbol_array(*((symbol_array_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_BOOLEAN:
+					result = new symbol_boolean(*((symbol_boolean_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_FLOAT:
+					result = new symbol_float(*((symbol_float_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_FUNCTION:
+					result = new symbol_function(*((symbol_function_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_IDENTIFIER:
+					result = new symbol_identifier(*((symbol_identifier_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_INTEGER:
+					result = new symbol_integer(*((symbol_integer_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_LITERAL_STRING:
+					result = new symbol_literal_string(*((symbol_literal_string_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_NULL:
+					result = new symbol_null(*((symbol_null_ptr) sym));
+					break;
+				case SCOPE_SYMBOL_STRUCTURE:
+					result = new symbol_structure(*((symbol_structure_ptr) sym));
+					break;
+				default:
+					THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_TYPE,
+						"%lu", sym->get_type());
+			}
+
+			result->set_parent(this);
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_scope::copy_symbols(
+			__in _scope &other
+			)
+		{
+			std::vector<symbol_ptr> sym_list;
+			std::vector<symbol_ptr>::iterator sym_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_frozen) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN);
+			}
+
+			other.enumerate_symbols(sym_list);
+
+			for(sym_iter = sym_list.begin(); sym_iter != sym_list.end(); ++sym_iter) {
+
+				if(!has_symbol((*sym_iter)->get_key_atom())) {
+					insert_symbol(copy_symbol(*sym_iter));
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		symbol_ptr 
+		_scope::detach_symbol(
+			__in atom_t key
+			)
+		{
+			size_t slot;
+			symbol_ptr base_sym, result = NULL;
+			std::vector<symbol_ptr>::iterator frame_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			slot = ((key != ATOM_INVALID) ? find_slot(key) : SCOPE_SLOT_NONE);
+			if(slot != SCOPE_SLOT_NONE) {
+				result = m_sym_table[slot].sym;
+			} else {
+
+				if(!m_base) {
+					THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND, 
+						"0x%x", key);
+				}
+
+				if(m_frozen) {
+					THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN);
+				}
+
+				base_sym = m_base->get_symbol(key);
+				result = copy_symbol(base_sym);
+				insert_symbol(result);
+				++m_shadow_count;
+
+				for(frame_iter = m_frame.begin(); frame_iter != m_frame.end(); ++frame_iter) {
+
+					if(*frame_iter == base_sym) {
+						*frame_iter = result;
+					}
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_scope::detach_symbol(
+			__in const std::string &key
+			)
+		{
+			atom_t atom;
+			symbol_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			atom = atom_factory::acquire()->find(key);
+			if(atom == ATOM_INVALID) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND, 
+					"%s", key.c_str());
+			}
+
+			result = detach_symbol(atom);
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_scope::enumerate_symbols(
+			__inout std::vector<symbol_ptr> &result
+			)
+		{
+			std::vector<symbol_ptr> base_list;
+			std::vector<symbol_ptr>::iterator sym_iter;
+			std::vector<scope_slot_t>::iterator slot_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
+
+				if(slot_iter->sym) {
+					result.push_back(slot_iter->sym);
+				}
+			}
+
+			if(m_base) {
+				m_base->enumerate_symbols(base_list);
+
+				for(sym_iter = base_list.begin(); sym_iter != base_list.end(); ++sym_iter) {
+
+					if(find_slot((*sym_iter)->get_key_atom()) == SCOPE_SLOT_NONE) {
+						result.push_back(*sym_iter);
+					}
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_scope::erase_slot(
+			__in size_t slot
+			)
+		{
+			size_t home, mask, next;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			mask = (m_sym_table.size() - 1);
+			next = ((slot + 1) & mask);
+
+			while(m_sym_table[next].key != ATOM_INVALID) {
+				home = (SCOPE_TABLE_HASH(m_sym_table[next].key) & mask);
+
+				if(((next - home) & mask) >= ((next - slot) & mask)) {
+					m_sym_table[slot] = m_sym_table[next];
+
+					if(heap::is_marking()) {
+						heap::acquire()->root_barrier(m_sym_table[slot].sym);
+					}
+
+					slot = next;
+				}
+
+				next = ((next + 1) & mask);
+			}
+
+			m_sym_table[slot].key = ATOM_INVALID;
+			m_sym_table[slot].sym = NULL;
+			--m_sym_count;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_scope::find_slot(
+			__in atom_t key
+			)
+		{
+			size_t mask, result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			mask = (m_sym_table.size() - 1);
+			result = (SCOPE_TABLE_HASH(key) & mask);
+
+			while(m_sym_table[result].key != key) {
+
+				if(m_sym_table[result].key == ATOM_INVALID) {
+					result = SCOPE_SLOT_NONE;
+					break;
+				}
+
+				result = ((result + 1) & mask);
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_scope::find_symbol(
+			__in atom_t key
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = ((key != ATOM_INVALID) ? find_slot(key) : SCOPE_SLOT_NONE);
+			if(result == SCOPE_SLOT_NONE) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND, 
+					"0x%x", key);
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_scope::find_symbol(
+			__in const uuid &id
+			)
+		{
+			size_t result;
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			id_iter = m_sym_id_map.find(id);
+			if(id_iter == m_sym_id_map.end()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_ID_NOT_FOUND, 
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = find_slot(id_iter->second->get_key_atom());
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_scope::find_symbol(
+			__in const std::string &key
+			)
+		{
+			atom_t atom;
+			size_t result = SCOPE_SLOT_NONE;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			atom = atom_factory::acquire()->find(key);
+			if(atom != ATOM_INVALID) {
+				result = find_slot(atom);
+			}
+
+			if(result == SCOPE_SLOT_NONE) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND, 
+					"%s", key.c_str());
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_scope::freeze(void)
+		{
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			for(id_iter = m_sym_id_map.begin(); id_iter != m_sym_id_map.end(); ++id_iter) {
+				id_iter->second->freeze();
+			}
+
+			m_frozen = true;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		std::shared_ptr<_scope> 
+		_scope::get_base(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", m_base.get());
+			return m_base;
+		}
+
+		size_t 
+		_scope::get_frame_size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_frame.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_scope::get_frame_slot(
+			__in size_t index
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(index >= m_frame.size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"pos/max: %lu/%lu", index, m_frame.size());
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", m_frame[index]);
+			return m_frame[index];
+		}
+
+		symbol_ptr 
+		_scope::get_symbol(
+			__in atom_t key
+			)
+		{
+			symbol_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_base && ((key == ATOM_INVALID) || (find_slot(key) == SCOPE_SLOT_NONE))) {
+				result = m_base->get_symbol(key);
+			} else {
+				result = m_sym_table[find_symbol(key)].sym;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_scope::get_symbol(
+			__in const uuid &id
+			)
+		{
+			symbol_ptr result;
+			std::unordered_map<uuid, symbol_ptr>::iterator id_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			id_iter = m_sym_id_map.find(id);
+			if(id_iter != m_sym_id_map.end()) {
+				result = id_iter->second;
+			} else {
+				result = (m_base ? m_base->get_symbol(id) : m_sym_table[find_symbol(id)].sym);
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_scope::get_symbol(
+			__in const std::string &key
+			)
+		{
+			atom_t atom;
+			symbol_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			atom = atom_factory::acquire()->find(key);
+			if(m_base && ((atom == ATOM_INVALID) || (find_slot(atom) == SCOPE_SLOT_NONE))) {
+				result = m_base->get_symbol(key);
+			} else {
+				result = m_sym_table[find_symbol(key)].sym;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		size_t 
+		_scope::get_table_size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_sym_table.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_scope::get_table_slot(
+			__in size_t index
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(index >= m_sym_table.size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"pos/max: %lu/%lu", index, m_sym_table.size());
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", m_sym_table[index].sym);
+			return m_sym_table[index].sym;
+		}
+
+		bool 
+		_scope::has_symbol(
+			__in atom_t key
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = ((key != ATOM_INVALID) && ((find_slot(key) != SCOPE_SLOT_NONE)
+					|| (m_base && m_base->has_symbol(key))));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_scope::has_symbol(
+			__in const uuid &id
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_sym_id_map.find(id) != m_sym_id_map.end());
+			if(!result && m_base) {
+				result = m_base->has_symbol(id);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_scope::has_symbol(
+			__in const std::string &key
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(key.empty()) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_INVALID_KEY);
+			}
+
+			result = has_symbol(atom_factory::acquire()->find(key));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_scope::insert_symbol(
+			__in symbol_ptr sym
+			)
+		{
+			size_t slot;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			for(sym_iter = m_sym_map.begin(); sym_iter != m_sym_map.end();
-					++sym_iter) {
-				
-				if(!sym_iter->second) {
-					continue;
-				}
+			if(((m_sym_count + 1) * SCOPE_TABLE_LOAD_DENOMINATOR) 
+					> (m_sym_table.size() * SCOPE_TABLE_LOAD_NUMERATOR)) {
+				resize_table(m_sym_table.size() * 2);
+			}
 
-				delete sym_iter->second;
-				sym_iter->second = NULL;
+			slot = SCOPE_TABLE_HASH(sym->get_key_atom()) & (m_sym_table.size() - 1);
+
+			while(m_sym_table[slot].key != ATOM_INVALID) {
+				slot = (slot + 1) & (m_sym_table.size() - 1);
 			}
 
-			m_sym_map.clear();
-			m_sym_lookup_map.clear();
+			m_sym_table[slot].key = sym->get_key_atom();
+			m_sym_table[slot].sym = sym;
+			m_sym_id_map[sym->get_id()] = sym;
+			++m_sym_count;
+
+			if(heap::is_marking()) {
+				heap::acquire()->root_barrier(sym);
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		std::map<std::string, uuid>::iterator 
-		_scope::find_lookup_symbol(
-			__in const std::string &key
-			)
+		bool 
+		_scope::is_frozen(void)
 		{
-			std::map<std::string, uuid>::iterator result;
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", m_frozen);
+			return m_frozen;
+		}
 
+		void 
+		_scope::remove_symbol(
+			__in atom_t key
+			)
+		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = m_sym_lookup_map.find(key);
-			if(result == m_sym_lookup_map.end()) {
-				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND, 
-					"%s", key.c_str());
-			}
+			remove_entry(find_symbol(key));
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return result;
 		}
 
-		std::map<uuid, symbol_ptr>::iterator 
-		_scope::find_symbol(
+		void 
+		_scope::remove_symbol(
 			__in const uuid &id
 			)
 		{
-			std::map<uuid, symbol_ptr>::iterator result;
-
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = m_sym_map.find(id);
-			if(result == m_sym_map.end()) {
-				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_ID_NOT_FOUND, 
-					"%s", uuid::id_as_string(id).c_str());
-			}
+			remove_entry(find_symbol(id));
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return result;
 		}
 
-		symbol_ptr 
-		_scope::get_symbol(
-			__in const uuid &id
+		void 
+		_scope::remove_symbol(
+			__in const std::string &key
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
+
+			remove_entry(find_symbol(key));
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_symbol(id)->second;
 		}
 
-		symbol_ptr 
-		_scope::get_symbol(
-			__in const std::string &key
+		void 
+		_scope::remove_entry(
+			__in size_t slot
 			)
 		{
+			std::vector<symbol_ptr>::iterator frame_iter;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_frozen) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN);
+			}
+
+			for(frame_iter = m_frame.begin(); frame_iter != m_frame.end(); ++frame_iter) {
+
+				if(*frame_iter == m_sym_table[slot].sym) {
+					*frame_iter = NULL;
+				}
+			}
+
+			if(m_base && m_base->has_symbol(m_sym_table[slot].key)) {
+				--m_shadow_count;
+			}
+
+			m_sym_id_map.erase(m_sym_table[slot].sym->get_id());
+			delete m_sym_table[slot].sym;
+			erase_slot(slot);
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return get_symbol(find_lookup_symbol(key)->second);
 		}
 
-		bool 
-		_scope::has_symbol(
-			__in const uuid &id
+		void 
+		_scope::resize_frame(
+			__in size_t size
 			)
 		{
-			bool result;
-
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = (m_sym_map.find(id) != m_sym_map.end());
+			m_frame.resize(size, NULL);
 
-			TRACE_EXIT("Return Value: 0x%x", result);
-			return result;
+			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		bool 
-		_scope::has_symbol(
-			__in const std::string &key
+		void 
+		_scope::resize_table(
+			__in size_t capacity
 			)
 		{
-			bool result;
+			size_t mask, slot;
+			std::vector<scope_slot_t> table(capacity);
+			std::vector<scope_slot_t>::iterator slot_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(key.empty()) {
-				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_INVALID_KEY);
+			mask = (capacity - 1);
+
+			for(slot_iter = table.begin(); slot_iter != table.end(); ++slot_iter) {
+				slot_iter->key = ATOM_INVALID;
+				slot_iter->sym = NULL;
 			}
 
-			result = (m_sym_lookup_map.find(key) != m_sym_lookup_map.end());
+			for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
 
-			TRACE_EXIT("Return Value: 0x%x", result);
-			return result;
+				if(slot_iter->key == ATOM_INVALID) {
+					continue;
+				}
+
+				slot = (SCOPE_TABLE_HASH(slot_iter->key) & mask);
+
+				while(table[slot].key != ATOM_INVALID) {
+					slot = ((slot + 1) & mask);
+				}
+
+				table[slot] = *slot_iter;
+			}
+
+			m_sym_table.swap(table);
+
+			if(heap::is_marking()) {
+
+				for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
+					heap::acquire()->root_barrier(slot_iter->sym);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_scope::remove_symbol(
-			__in const uuid &id
+		_scope::set_base(
+			__in const std::shared_ptr<_scope> &base
 			)
 		{
-			std::map<uuid, symbol_ptr>::iterator sym_iter;
+			std::vector<symbol_ptr>::iterator frame_iter;
+			std::vector<scope_slot_t>::iterator slot_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			sym_iter = find_symbol(id);
-			if(sym_iter->second) {
-				delete sym_iter->second;
-				sym_iter->second = NULL;
+			if(m_frozen) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN);
+			}
+
+			if(base && ((base.get() == this) || !base->is_frozen())) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_SCOPE_NOT_FROZEN);
+			}
+
+			m_base = base;
+			m_shadow_count = 0;
+
+			if(m_base && heap::is_marking()) {
+				heap::acquire()->root_barrier(m_base);
+			}
+
+			if(m_base) {
+
+				for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
+
+					if(slot_iter->sym && m_base->has_symbol(slot_iter->key)) {
+						++m_shadow_count;
+					}
+				}
 			}
 
-			m_sym_map.erase(sym_iter);
+			for(frame_iter = m_frame.begin(); frame_iter != m_frame.end(); ++frame_iter) {
+
+				if(*frame_iter && (find_slot((*frame_iter)->get_key_atom()) == SCOPE_SLOT_NONE)) {
+					*frame_iter = NULL;
+				}
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		void 
-		_scope::remove_symbol(
-			__in const std::string &key
+		_scope::set_frame_slot(
+			__in size_t index,
+			__in atom_t key
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_sym_lookup_map.erase(find_lookup_symbol(key));
+			if(index >= m_frame.size()) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_INVALID_INDEX,
+					"pos/max: %lu/%lu", index, m_frame.size());
+			}
+
+			m_frame[index] = get_symbol(key);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -1645,7 +3036,11 @@ namespace LUNA_NS {
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = m_sym_lookup_map.size();
+			result = m_sym_count;
+
+			if(m_base) {
+				result += (m_base->size() - m_shadow_count);
+			}
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
@@ -1710,8 +3105,7 @@ namespace LUNA_NS {
 		{
 			size_t count = 0;
 			std::stringstream result;
-			std::map<std::string, uuid>::iterator sym_lookup_iter;
-			std::map<uuid, symbol_ptr>::iterator sym_iter;
+			std::vector<scope_slot_t>::iterator slot_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -1720,15 +3114,27 @@ namespace LUNA_NS {
 				result << uuid_base::to_string(verbose) << " ";
 			}
 
-			result << "Entries: " << m_sym_lookup_map.size();
+			result << "Entries: " << m_sym_count;
+
+			if(m_base) {
+				result << ", Inherited: " << (m_base->size() - m_shadow_count);
+			}
+
+			if(m_frozen) {
+				result << " (frozen)";
+			}
 
 			if(verbose) {
 				
-				for(sym_lookup_iter = m_sym_lookup_map.begin(), sym_iter = m_sym_map.begin(); 
-						sym_lookup_iter != m_sym_lookup_map.end(), sym_iter != m_sym_map.end(); 
-						++sym_lookup_iter, ++sym_iter, ++count) {
-					result << "--- [" << count << "/" << m_sym_map.size() << "] \'" << 
-						sym_lookup_iter->first << "\': " << symbol_as_string(sym_iter->second);
+				for(slot_iter = m_sym_table.begin(); slot_iter != m_sym_table.end(); ++slot_iter) {
+
+					if(slot_iter->key == ATOM_INVALID) {
+						continue;
+					}
+
+					result << "--- [" << count++ << "/" << m_sym_count << "] \'" << 
+						atom_factory::acquire()->get_text(slot_iter->key) << "\': " 
+						<< symbol_as_string(slot_iter->sym);
 				}
 			}
 
@@ -1736,18 +3142,11 @@ namespace LUNA_NS {
 			return result.str();
 		}
 
-		_scope_factory::_scope_factory(
-			__in_opt generic_cb_t dest
-			)
+		_scope_factory::_scope_factory(void) :
+			m_id_mapping(HANDLE_ID_MAPPING_DEFAULT),
+			m_initialized(false)
 		{
 			TRACE_ENTRY();
-
-			if(dest) {
-				std::atexit(dest);
-			} else {
-				std::atexit(scope_factory_destroy);
-			}
-
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
@@ -1765,16 +3164,22 @@ namespace LUNA_NS {
 			__in_opt generic_cb_t dest
 			)
 		{
-			scope_factory_ptr result = NULL;
+			scope_factory_ptr result;
 
 			TRACE_ENTRY();
 
 			if(!m_instance) {
-			
-				m_instance = new scope_factory(dest);
+				
+				m_instance = new scope_factory;
 				if(!m_instance) {
 					THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_ALLOC_FAILED);
 				}
+
+				if(dest) {
+					std::atexit(dest);
+				} else {
+					std::atexit(scope_factory_destroy);
+				}
 			}
 
 			result = m_instance;
@@ -1783,9 +3188,52 @@ namespace LUNA_NS {
 			return result;
 		}
 
+		handle_t 
+		_scope_factory::add_scope(
+			__in const uuid &id,
+			__in const scope &scop
+			)
+		{
+			uint32_t slot;
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(m_id_mapping && (m_id_map.find(id) != m_id_map.end())) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_SCOPE_ALREADY_ADDED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = m_handle_table.allocate();
+			slot = HANDLE_SLOT(result);
+
+			if(slot >= m_scope_list.size()) {
+				m_scope_list.resize(slot + 1, NULL);
+			}
+
+			m_scope_list.at(slot) = new scope(scop);
+			if(!m_scope_list.at(slot)) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_ALLOC_FAILED);
+			}
+
+			if(m_id_mapping) {
+				m_id_map.insert(std::pair<uuid, handle_t>(id, result));
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
 		void 
 		_scope_factory::clear(void)
 		{
+			std::vector<scope_ptr>::iterator scop_iter;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -1793,7 +3241,16 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_scope_map.clear();
+			for(scop_iter = m_scope_list.begin(); scop_iter != m_scope_list.end(); ++scop_iter) {
+
+				if(*scop_iter) {
+					delete *scop_iter;
+				}
+			}
+
+			m_scope_list.clear();
+			m_handle_table.clear();
+			m_id_map.clear();
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -1812,12 +3269,12 @@ namespace LUNA_NS {
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		std::map<uuid, scope>::iterator 
-		_scope_factory::find_scope(
+		std::unordered_map<uuid, handle_t>::iterator 
+		_scope_factory::find_handle(
 			__in const uuid &id
 			)
 		{
-			std::map<uuid, scope>::iterator result;
+			std::unordered_map<uuid, handle_t>::iterator result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -1826,8 +3283,13 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_scope_map.find(id);
-			if(result == m_scope_map.end()) {
+			if(!m_id_mapping) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_SCOPE_UNMAPPED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = m_id_map.find(id);
+			if(result == m_id_map.end()) {
 				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_SCOPE_NOT_FOUND,
 					"%s", uuid::id_as_string(id).c_str());
 			}
@@ -1836,22 +3298,70 @@ namespace LUNA_NS {
 			return result;
 		}
 
-		scope &
+		scope_ptr 
+		_scope_factory::find_scope(
+			__in handle_t handle
+			)
+		{
+			scope_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_scope_list[m_handle_table.get_slot(handle)];
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		handle_t 
 		_scope_factory::generate(void)
 		{
 			scope scop;
+			handle_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-
+			
 			if(!m_initialized) {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_scope_map.insert(std::pair<uuid, scope>(scop.get_id(), scop));
+			result = add_scope(scop.get_id(), scop);
 
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		handle_t 
+		_scope_factory::get_handle(
+			__in const uuid &id
+			)
+		{
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = find_handle(id)->second;
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		scope &
+		_scope_factory::get_scope(
+			__in handle_t handle
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_scope(scop.get_id())->second;
+			return *find_scope(handle);
 		}
 
 		scope &
@@ -1859,6 +3369,19 @@ namespace LUNA_NS {
 			__in const uuid &id
 			)
 		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return *find_scope(find_handle(id)->second);
+		}
+
+		bool 
+		_scope_factory::has_scope(
+			__in handle_t handle
+			)
+		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -1866,8 +3389,10 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_scope(id)->second;
+			result = m_handle_table.is_valid(handle);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		bool 
@@ -1884,38 +3409,67 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = (m_scope_map.find(id) != m_scope_map.end());
+			if(!m_id_mapping) {
+				THROW_LUNA_SCOPE_EXCEPTION_MESSAGE(LUNA_SCOPE_EXCEPTION_SCOPE_UNMAPPED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = (m_id_map.find(id) != m_id_map.end());
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
 		void 
-		_scope_factory::initialize(void)
+		_scope_factory::initialize(
+			__in_opt bool id_mapping
+			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			destroy();
+			m_id_mapping = id_mapping;
 			m_initialized = true;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		bool 
+		_scope_factory::is_id_mapped(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_id_mapping;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
 		bool 
 		_scope_factory::is_initialized(void)
 		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT("Return Value: 0x%x", m_initialized);
-			return m_initialized;
+
+			result = m_initialized;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		void 
 		_scope_factory::remove_scope(
-			__in const uuid &id
+			__in handle_t handle
 			)
 		{
+			uint32_t slot;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -1923,7 +3477,28 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_scope_map.erase(find_scope(id));
+			slot = m_handle_table.get_slot(handle);
+
+			if(m_id_mapping) {
+				m_id_map.erase(m_scope_list.at(slot)->get_id());
+			}
+
+			delete m_scope_list.at(slot);
+			m_scope_list.at(slot) = NULL;
+			m_handle_table.release(handle);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_scope_factory::remove_scope(
+			__in const uuid &id
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			remove_scope(find_handle(id)->second);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -1940,7 +3515,7 @@ namespace LUNA_NS {
 				THROW_LUNA_SCOPE_EXCEPTION(LUNA_SCOPE_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_scope_map.size();
+			result = m_handle_table.size();
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
@@ -1948,11 +3523,11 @@ namespace LUNA_NS {
 
 		std::string 
 		_scope_factory::to_string(
-			__in bool verbose
+			__in_opt bool verbose
 			)
 		{
 			std::stringstream result;
-			std::map<uuid, scope>::iterator scope_iter;
+			std::vector<scope_ptr>::iterator scop_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -1965,10 +3540,18 @@ namespace LUNA_NS {
 				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
 			}
 
-			result << "Entries: " << m_scope_map.size();
+			result << "Entries: " << m_handle_table.size();
+
+			if(verbose) {
+				result << ", " << m_handle_table.to_string(verbose) << ", UUID mapping: " 
+					<< (m_id_mapping ? "on" : "off");
+			}
+			
+			for(scop_iter = m_scope_list.begin(); scop_iter != m_scope_list.end(); ++scop_iter) {
 
-			for(scope_iter = m_scope_map.begin(); scope_iter != m_scope_map.end(); ++scope_iter) {
-				result << std::endl << "---" << std::endl << scope_iter->second.to_string(verbose);
+				if(*scop_iter) {
+					result << std::endl << (*scop_iter)->to_string(verbose);
+				}
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -20,6 +20,9 @@
 #ifndef LUNA_SCOPE_H_
 #define LUNA_SCOPE_H_
 
+#include <memory>
+#include <unordered_map>
+
 namespace LUNA_NS {
 
 	namespace LUNA_COMP_NS {
@@ -38,8 +41,38 @@ namespace LUNA_NS {
 
 		#define SCOPE_SYMBOL_MAX SCOPE_SYMBOL_STRUCTURE
 
+		typedef enum {
+			SYMBOL_ARRAY_STORE_BOOLEAN = 0,
+			SYMBOL_ARRAY_STORE_BOXED,
+			SYMBOL_ARRAY_STORE_EMPTY,
+			SYMBOL_ARRAY_STORE_FLOAT,
+			SYMBOL_ARRAY_STORE_INTEGER,
+		} array_store_t;
+
+		#define SYMBOL_ARRAY_STORE_MAX SYMBOL_ARRAY_STORE_INTEGER
+
+		#define SCOPE_SLOT_NONE ((size_t) INVALID)
+		#define SCOPE_TABLE_CAPACITY 0x08
+
 		class _scope;
 
+		class _value;
+
+		typedef struct {
+			std::vector<uint8_t> boolean;
+			std::vector<_value> boxed;
+			std::vector<double> floating;
+			std::vector<int32_t> integer;
+			std::vector<uuid> reference;
+			array_store_t type;
+		} array_store_data_t, *array_store_data_ptr_t;
+
+		typedef std::shared_ptr<array_store_data_t> array_store_shared_t;
+
+		typedef std::shared_ptr<std::vector<uuid>> structure_slot_shared_t;
+
+		typedef std::shared_ptr<std::string> literal_string_shared_t;
+
 		typedef class _symbol :
 				public uuid_base {
 		
@@ -61,14 +94,28 @@ namespace LUNA_NS {
 					__in const _symbol &other
 					);
 
-				std::string &get_key(void);
+				void freeze(void);
+
+				const std::string &get_key(void);
+
+				atom_t get_key_atom(void);
 
 				scope_sym_t get_type(void);
 
+				bool is_frozen(void);
+
+				void set_key(
+					__in atom_t key
+					);
+
 				void set_key(
 					__in const std::string &key
 					);
 
+				void set_parent(
+					__in _scope *parent
+					);
+
 				void set_type(
 					__in scope_sym_t type
 					);
@@ -79,7 +126,11 @@ namespace LUNA_NS {
 
 			protected:
 
-				std::string m_key;
+				void check_writable(void);
+
+				bool m_frozen;
+
+				atom_t m_key;
 
 				_scope *m_parent;
 
@@ -109,16 +160,33 @@ namespace LUNA_NS {
 					__in _symbol_array &other
 					);
 
+				void add_element(
+					__in const _value &element
+					);
+
 				void add_value(
 					__in const uuid &value
 					);
 
 				void clear(void);
 
+				_value get_element(
+					__in size_t index
+					);
+
+				array_store_t get_store(void);
+
+				size_t get_store_size(void);
+
 				uuid get_value(
 					__in size_t index
 					);
 
+				void insert_element(
+					__in const _value &element,
+					__in size_t index
+					);
+
 				void insert_value(
 					__in const uuid &value,
 					__in size_t index
@@ -128,11 +196,22 @@ namespace LUNA_NS {
 					__in size_t index
 					);
 
+				void set_element(
+					__in const _value &element,
+					__in size_t index
+					);
+
 				void set_value(
 					__in const uuid &value,
 					__in size_t index
 					);
 
+				bool is_reference(
+					__in size_t index
+					);
+
+				bool is_shared(void);
+
 				virtual size_t size(void);
 
 				virtual std::string to_string(
@@ -141,7 +220,19 @@ namespace LUNA_NS {
 
 			protected:
 
-				std::vector<uuid> m_value;
+				void box_store(void);
+
+				void detach(void);
+
+				void prepare_store(
+					__in const _value &element
+					);
+
+				symbol_ptr resolve_reference(
+					__in const uuid &id
+					);
+
+				array_store_shared_t m_store;
 
 		} symbol_array, *symbol_array_ptr;
 
@@ -245,6 +336,10 @@ namespace LUNA_NS {
 					__in size_t index
 					);
 
+				atom_t get_paramter_atom(
+					__in size_t index
+					);
+
 				size_t get_paramter_count(void);
 
 				uuid get_statement(
@@ -253,6 +348,10 @@ namespace LUNA_NS {
 
 				size_t get_statement_count(void);
 
+				void set_parameters(
+					__in const std::vector<atom_t> &parameters
+					);
+
 				void set_parameters(
 					__in const std::vector<std::string> &parameters
 					);
@@ -267,7 +366,7 @@ namespace LUNA_NS {
 
 			protected:
 
-				std::vector<std::string> m_parameter;
+				std::vector<atom_t> m_parameter;
 
 				std::vector<uuid> m_statement;
 
@@ -368,7 +467,9 @@ namespace LUNA_NS {
 					__in _symbol_literal_string &other
 					);
 
-				std::string get_value(void);
+				const std::string &get_value(void);
+
+				bool is_shared(void);
 
 				void set_value(
 					__in const std::string &value
@@ -380,7 +481,7 @@ namespace LUNA_NS {
 
 			protected:
 
-				std::string m_value;
+				literal_string_shared_t m_value;
 
 		} symbol_literal_string, *symbol_literal_string_ptr;
 
@@ -430,6 +531,11 @@ namespace LUNA_NS {
 					__in _symbol_structure &other
 					);
 
+				void add_value(
+					__in atom_t key,
+					__in const uuid &value
+					);
+
 				void add_value(
 					__in const std::string &key,
 					__in const uuid &value
@@ -437,18 +543,46 @@ namespace LUNA_NS {
 
 				void clear(void);
 
+				shape_ptr get_shape(void);
+
+				uuid get_value(
+					__in atom_t key
+					);
+
+				uuid get_value(
+					__in atom_t key,
+					__inout shape_cache_t &cache
+					);
+
 				uuid get_value(
 					__in const std::string &key
 					);
 
+				bool has_value(
+					__in atom_t key
+					);
+
 				bool has_value(
 					__in const std::string &key
 					);
 
+				bool is_shared(void);
+
 				void remove_value(
 					__in const std::string &key
 					);
 
+				void set_value(
+					__in atom_t key,
+					__in const uuid &value
+					);
+
+				void set_value(
+					__in atom_t key,
+					__in const uuid &value,
+					__inout shape_cache_t &cache
+					);
+
 				void set_value(
 					__in const std::string &key,
 					__in const uuid &value
@@ -462,14 +596,28 @@ namespace LUNA_NS {
 
 			protected:
 
-				std::map<std::string, uuid>::iterator find_value(
-					__in const std::string &key
+				void detach(void);
+
+				size_t find_slot(
+					__in atom_t key
+					);
+
+				size_t find_slot(
+					__in atom_t key,
+					__inout shape_cache_t &cache
 					);
 
-				std::map<std::string, uuid> m_value;
+				shape_ptr m_shape;
+
+				structure_slot_shared_t m_slot;
 
 		} symbol_structure, *symbol_structure_ptr;
 
+		typedef struct {
+			atom_t key;
+			symbol_ptr sym;
+		} scope_slot_t, *scope_slot_ptr_t;
+
 		typedef class _scope :
 				public uuid_base {
 		
@@ -530,6 +678,36 @@ namespace LUNA_NS {
 
 				virtual void clear(void);
 
+				void copy_symbols(
+					__in _scope &other
+					);
+
+				symbol_ptr detach_symbol(
+					__in atom_t key
+					);
+
+				symbol_ptr detach_symbol(
+					__in const std::string &key
+					);
+
+				void enumerate_symbols(
+					__inout std::vector<symbol_ptr> &result
+					);
+
+				void freeze(void);
+
+				std::shared_ptr<_scope> get_base(void);
+
+				size_t get_frame_size(void);
+
+				symbol_ptr get_frame_slot(
+					__in size_t index
+					);
+
+				symbol_ptr get_symbol(
+					__in atom_t key
+					);
+
 				symbol_ptr get_symbol(
 					__in const uuid &id
 					);
@@ -538,6 +716,16 @@ namespace LUNA_NS {
 					__in const std::string &key
 					);
 
+				size_t get_table_size(void);
+
+				symbol_ptr get_table_slot(
+					__in size_t index
+					);
+
+				bool has_symbol(
+					__in atom_t key
+					);
+
 				bool has_symbol(
 					__in const uuid &id
 					);
@@ -546,6 +734,12 @@ namespace LUNA_NS {
 					__in const std::string &key
 					);
 
+				bool is_frozen(void);
+
+				void remove_symbol(
+					__in atom_t key
+					);
+
 				void remove_symbol(
 					__in const uuid &id
 					);
@@ -554,6 +748,19 @@ namespace LUNA_NS {
 					__in const std::string &key
 					);
 
+				void resize_frame(
+					__in size_t size
+					);
+
+				void set_base(
+					__in const std::shared_ptr<_scope> &base
+					);
+
+				void set_frame_slot(
+					__in size_t index,
+					__in atom_t key
+					);
+
 				virtual size_t size(void);
 
 				static std::string symbol_as_string(
@@ -576,17 +783,55 @@ namespace LUNA_NS {
 					__in scope_sym_t type
 					);
 
-				std::map<std::string, uuid>::iterator find_lookup_symbol(
-					__in const std::string &key
+				symbol_ptr copy_symbol(
+					__in symbol_ptr sym
+					);
+
+				void erase_slot(
+					__in size_t slot
+					);
+
+				size_t find_slot(
+					__in atom_t key
+					);
+
+				size_t find_symbol(
+					__in atom_t key
 					);
 
-				std::map<uuid, symbol_ptr>::iterator find_symbol(
+				size_t find_symbol(
 					__in const uuid &id
 					);
 
-				std::map<std::string, uuid> m_sym_lookup_map;
+				size_t find_symbol(
+					__in const std::string &key
+					);
+
+				void insert_symbol(
+					__in symbol_ptr sym
+					);
+
+				void remove_entry(
+					__in size_t slot
+					);
+
+				void resize_table(
+					__in size_t capacity
+					);
+
+				std::shared_ptr<_scope> m_base;
+
+				std::vector<symbol_ptr> m_frame;
 
-				std::map<uuid, symbol_ptr> m_sym_map; 
+				bool m_frozen;
+
+				size_t m_shadow_count;
+
+				size_t m_sym_count;
+
+				std::unordered_map<uuid, symbol_ptr> m_sym_id_map;
+
+				std::vector<scope_slot_t> m_sym_table;
 
 			private:
 
@@ -594,6 +839,8 @@ namespace LUNA_NS {
 
 		} scope, *scope_ptr;
 
+		typedef std::shared_ptr<scope> scope_shared_t;
+
 		typedef class _scope_factory {
 			
 			public:
@@ -602,24 +849,49 @@ namespace LUNA_NS {
 					__in_opt generic_cb_t dest = NULL
 					);
 
+				handle_t add_scope(
+					__in const uuid &id,
+					__in const scope &scop
+					);
+
 				void clear(void);
 
 				void destroy(void);
 
-				scope &generate(void);
+				handle_t generate(void);
+
+				handle_t get_handle(
+					__in const uuid &id
+					);
+
+				scope &get_scope(
+					__in handle_t handle
+					);
 
 				scope &get_scope(
 					__in const uuid &id
 					);
 
+				bool has_scope(
+					__in handle_t handle
+					);
+
 				bool has_scope(
 					__in const uuid &id
 					);
 
-				void initialize(void);
+				void initialize(
+					__in_opt bool id_mapping = HANDLE_ID_MAPPING_DEFAULT
+					);
+
+				bool is_id_mapped(void);
 
 				bool is_initialized(void);
 
+				void remove_scope(
+					__in handle_t handle
+					);
+
 				void remove_scope(
 					__in const uuid &id
 					);
@@ -632,11 +904,11 @@ namespace LUNA_NS {
 
 			protected:
 
+				friend class _context;
+
 				friend void scope_factory_destroy(void);
 
-				_scope_factory(
-					__in_opt generic_cb_t dest = NULL
-					);
+				_scope_factory(void);
 
 				_scope_factory(
 					__in const _node_factory &other
@@ -648,15 +920,25 @@ namespace LUNA_NS {
 					__in const _scope_factory &other
 					);
 
-				std::map<uuid, scope>::iterator find_scope(
+				std::unordered_map<uuid, handle_t>::iterator find_handle(
 					__in const uuid &id
 					);
 
+				scope_ptr find_scope(
+					__in handle_t handle
+					);
+
+				handle_table m_handle_table;
+
+				bool m_id_mapping;
+
+				std::unordered_map<uuid, handle_t> m_id_map;
+
 				bool m_initialized;
 
 				static _scope_factory *m_instance;
 
-				std::map<uuid, scope> m_scope_map;
+				std::vector<scope_ptr> m_scope_list;
 
 			private:
 
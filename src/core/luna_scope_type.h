@@ -33,7 +33,11 @@ namespace LUNA_NS {
 			LUNA_SCOPE_EXCEPTION_INVALID_TYPE,
 			LUNA_SCOPE_EXCEPTION_KEY_ALREADY_EXISTS,
 			LUNA_SCOPE_EXCEPTION_KEY_NOT_FOUND,
+			LUNA_SCOPE_EXCEPTION_SCOPE_ALREADY_ADDED,
+			LUNA_SCOPE_EXCEPTION_SCOPE_FROZEN,
 			LUNA_SCOPE_EXCEPTION_SCOPE_NOT_FOUND,
+			LUNA_SCOPE_EXCEPTION_SCOPE_NOT_FROZEN,
+			LUNA_SCOPE_EXCEPTION_SCOPE_UNMAPPED,
 			LUNA_SCOPE_EXCEPTION_UNINITIALIZED,
 		};
 
@@ -46,7 +50,11 @@ namespace LUNA_NS {
 			"Invalid symbol type",
 			"Symbol already exists in scope",
 			"Symbol was not found in scope",
+			"Scope UUID was already added",
+			"Scope is frozen",
 			"Scope was not found",
+			"Base scope is not frozen",
+			"Scope UUID mapping is disabled",
 			"Scope factory uninitialized",
 			};
 
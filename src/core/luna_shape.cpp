@@ -0,0 +1,523 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "luna.h"
+#include "luna_shape_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		_shape_factory *_shape_factory::m_instance = NULL;
+
+		void 
+		shape_factory_destroy(void)
+		{
+			TRACE_ENTRY();
+
+			if(shape_factory::m_instance) {
+				delete shape_factory::m_instance;
+				shape_factory::m_instance = NULL;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_shape::_shape(
+			__in_opt _shape *parent,
+			__in_opt atom_t key
+			) :
+				m_key(key),
+				m_parent(parent)
+		{
+			TRACE_ENTRY();
+
+			if(m_parent) {
+				m_field_list = m_parent->m_field_list;
+				m_field_map = m_parent->m_field_map;
+				m_field_map.insert(std::pair<atom_t, size_t>(m_key, m_field_list.size()));
+				m_field_list.push_back(m_key);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_shape::~_shape(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_shape::add_transition(
+			__in atom_t key,
+			__in _shape *child
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_transition_map.insert(std::pair<atom_t, _shape *>(key, child));
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_shape::find_slot(
+			__in atom_t key
+			)
+		{
+			size_t result = SHAPE_SLOT_NONE;
+			std::unordered_map<atom_t, size_t>::iterator field_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			field_iter = m_field_map.find(key);
+			if(field_iter != m_field_map.end()) {
+				result = field_iter->second;
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		_shape *
+		_shape::find_transition(
+			__in atom_t key
+			)
+		{
+			_shape *result = NULL;
+			std::unordered_map<atom_t, _shape *>::iterator trans_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			trans_iter = m_transition_map.find(key);
+			if(trans_iter != m_transition_map.end()) {
+				result = trans_iter->second;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		atom_t 
+		_shape::get_field(
+			__in size_t slot
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(slot >= m_field_list.size()) {
+				THROW_LUNA_SHAPE_EXCEPTION_MESSAGE(LUNA_SHAPE_EXCEPTION_INVALID_SLOT,
+					"slot/max: %lu/%lu", slot, m_field_list.size());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", m_field_list[slot]);
+			return m_field_list[slot];
+		}
+
+		atom_t 
+		_shape::get_key(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", m_key);
+			return m_key;
+		}
+
+		_shape *
+		_shape::get_parent(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", m_parent);
+			return m_parent;
+		}
+
+		bool 
+		_shape::has_field(
+			__in atom_t key
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = (m_field_map.find(key) != m_field_map.end());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		size_t 
+		_shape::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_field_list.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_shape::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+			std::vector<atom_t>::iterator field_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(verbose) {
+				result << "(0x" << VALUE_AS_HEX(uintptr_t, this) << ") ";
+			}
+
+			result << "Fields: " << m_field_list.size() << ", Transitions: " << m_transition_map.size() 
+				<< " {";
+
+			for(field_iter = m_field_list.begin(); field_iter != m_field_list.end(); ++field_iter) {
+
+				if(field_iter != m_field_list.begin()) {
+					result << ", ";
+				}
+
+				result << atom_factory::acquire()->get_text(*field_iter);
+			}
+
+			result << "}";
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		_shape_factory::_shape_factory(
+			__in_opt generic_cb_t dest
+			) :
+				m_hit_count(0),
+				m_initialized(false),
+				m_lookup_count(0),
+				m_root(NULL)
+		{
+			TRACE_ENTRY();
+
+			if(dest) {
+				std::atexit(dest);
+			} else {
+				std::atexit(shape_factory_destroy);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_shape_factory::~_shape_factory(void)
+		{
+			TRACE_ENTRY();
+
+			destroy();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_shape_factory *
+		_shape_factory::acquire(
+			__in_opt generic_cb_t dest
+			)
+		{
+			shape_factory_ptr result;
+
+			TRACE_ENTRY();
+
+			if(!m_instance) {
+				
+				m_instance = new shape_factory(dest);
+				if(!m_instance) {
+					THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_ALLOC_FAILED);
+				}
+			}
+
+			result = m_instance;
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_shape_factory::clear(void)
+		{
+			std::vector<shape_ptr>::iterator shape_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			for(shape_iter = m_shape_list.begin(); shape_iter != m_shape_list.end(); ++shape_iter) {
+				delete *shape_iter;
+			}
+
+			m_shape_list.clear();
+			m_hit_count = 0;
+			m_lookup_count = 0;
+
+			m_root = new shape;
+			if(!m_root) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_ALLOC_FAILED);
+			}
+
+			m_shape_list.push_back(m_root);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_shape_factory::destroy(void)
+		{
+			std::vector<shape_ptr>::iterator shape_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized) {
+
+				for(shape_iter = m_shape_list.begin(); shape_iter != m_shape_list.end(); ++shape_iter) {
+					delete *shape_iter;
+				}
+
+				m_shape_list.clear();
+				m_root = NULL;
+				m_hit_count = 0;
+				m_lookup_count = 0;
+				m_initialized = false;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_shape_factory::get_hit_count(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_hit_count;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_shape_factory::get_lookup_count(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_lookup_count;
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		shape_ptr 
+		_shape_factory::get_root(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", m_root);
+			return m_root;
+		}
+
+		shape_ptr 
+		_shape_factory::get_transition(
+			__in shape_ptr from,
+			__in atom_t key
+			)
+		{
+			shape_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!from) {
+				from = m_root;
+			}
+
+			if(from->has_field(key)) {
+				THROW_LUNA_SHAPE_EXCEPTION_MESSAGE(LUNA_SHAPE_EXCEPTION_FIELD_ALREADY_EXISTS,
+					"0x%x", key);
+			}
+
+			++m_lookup_count;
+
+			result = from->find_transition(key);
+			if(result) {
+				++m_hit_count;
+			} else {
+
+				result = new shape(from, key);
+				if(!result) {
+					THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_ALLOC_FAILED);
+				}
+
+				m_shape_list.push_back(result);
+				from->add_transition(key, result);
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		void 
+		_shape_factory::initialize(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			destroy();
+			m_initialized = true;
+			clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		bool 
+		_shape_factory::is_initialized(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_initialized;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		shape_ptr 
+		_shape_factory::remove_field(
+			__in shape_ptr from,
+			__in atom_t key
+			)
+		{
+			size_t iter;
+			shape_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!from || !from->has_field(key)) {
+				THROW_LUNA_SHAPE_EXCEPTION_MESSAGE(LUNA_SHAPE_EXCEPTION_FIELD_NOT_FOUND,
+					"0x%x", key);
+			}
+
+			result = m_root;
+
+			for(iter = 0; iter < from->size(); ++iter) {
+
+				if(from->get_field(iter) != key) {
+					result = get_transition(result, from->get_field(iter));
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		size_t 
+		_shape_factory::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_shape_list.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_shape_factory::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+			std::vector<shape_ptr>::iterator shape_iter;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_SHAPE_EXCEPTION(LUNA_SHAPE_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(verbose) {
+				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
+			}
+
+			result << "Shapes: " << m_shape_list.size() << ", Lookups: " << m_lookup_count 
+				<< ", Hits: " << m_hit_count;
+
+			if(verbose) {
+
+				for(shape_iter = m_shape_list.begin(); shape_iter != m_shape_list.end(); ++shape_iter) {
+					result << std::endl << "{" << (shape_iter - m_shape_list.begin()) << "} " 
+						<< (*shape_iter)->to_string(verbose);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+	}
+}
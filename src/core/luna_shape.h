@@ -0,0 +1,185 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_SHAPE_H_
+#define LUNA_SHAPE_H_
+
+#include <unordered_map>
+#include <vector>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		#define SHAPE_SLOT_NONE ((size_t) INVALID)
+
+		class _shape_factory;
+
+		typedef class _shape {
+
+			public:
+
+				size_t find_slot(
+					__in atom_t key
+					);
+
+				atom_t get_field(
+					__in size_t slot
+					);
+
+				atom_t get_key(void);
+
+				_shape *get_parent(void);
+
+				bool has_field(
+					__in atom_t key
+					);
+
+				size_t size(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				friend class _shape_factory;
+
+				_shape(
+					__in_opt _shape *parent = NULL,
+					__in_opt atom_t key = ATOM_INVALID
+					);
+
+				_shape(
+					__in const _shape &other
+					);
+
+				~_shape(void);
+
+				_shape &operator=(
+					__in const _shape &other
+					);
+
+				void add_transition(
+					__in atom_t key,
+					__in _shape *child
+					);
+
+				_shape *find_transition(
+					__in atom_t key
+					);
+
+				std::unordered_map<atom_t, size_t> m_field_map;
+
+				std::vector<atom_t> m_field_list;
+
+				atom_t m_key;
+
+				_shape *m_parent;
+
+				std::unordered_map<atom_t, _shape *> m_transition_map;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} shape, *shape_ptr;
+
+		typedef struct {
+			shape_ptr layout;
+			size_t slot;
+		} shape_cache_t, *shape_cache_ptr_t;
+
+		typedef class _shape_factory {
+
+			public:
+
+				static _shape_factory *acquire(
+					__in_opt generic_cb_t dest = NULL
+					);
+
+				void clear(void);
+
+				void destroy(void);
+
+				size_t get_hit_count(void);
+
+				size_t get_lookup_count(void);
+
+				shape_ptr get_root(void);
+
+				shape_ptr get_transition(
+					__in shape_ptr from,
+					__in atom_t key
+					);
+
+				void initialize(void);
+
+				bool is_initialized(void);
+
+				shape_ptr remove_field(
+					__in shape_ptr from,
+					__in atom_t key
+					);
+
+				size_t size(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				friend void shape_factory_destroy(void);
+
+				_shape_factory(
+					__in_opt generic_cb_t dest = NULL
+					);
+
+				_shape_factory(
+					__in const _shape_factory &other
+					);
+
+				~_shape_factory(void);
+
+				_shape_factory &operator=(
+					__in const _shape_factory &other
+					);
+
+				size_t m_hit_count;
+
+				bool m_initialized;
+
+				static _shape_factory *m_instance;
+
+				size_t m_lookup_count;
+
+				shape_ptr m_root;
+
+				std::vector<shape_ptr> m_shape_list;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} shape_factory, *shape_factory_ptr;
+	}
+}
+
+#endif // LUNA_SHAPE_H_
@@ -0,0 +1,62 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_SHAPE_TYPE_H_
+#define LUNA_SHAPE_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_SHAPE_EXCEPTION_ALLOC_FAILED = 0,
+			LUNA_SHAPE_EXCEPTION_FIELD_ALREADY_EXISTS,
+			LUNA_SHAPE_EXCEPTION_FIELD_NOT_FOUND,
+			LUNA_SHAPE_EXCEPTION_INVALID_SHAPE,
+			LUNA_SHAPE_EXCEPTION_INVALID_SLOT,
+			LUNA_SHAPE_EXCEPTION_UNINITIALIZED,
+		};
+
+		static const std::string LUNA_SHAPE_EXCEPTION_STR[] = {
+			"Shape factory allocation failed",
+			"Field already exists in shape",
+			"Field was not found in shape",
+			"Invalid shape",
+			"Invalid shape slot",
+			"Shape factory uninitialized",
+			};
+
+		#define LUNA_SHAPE_EXCEPTION_MAX LUNA_SHAPE_EXCEPTION_UNINITIALIZED
+
+		#define LUNA_SHAPE_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_SHAPE_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_SHAPE_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_SHAPE_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_SHAPE_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_SHAPE_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_SHAPE_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _shape;
+		typedef _shape shape, *shape_ptr;
+
+		class _shape_factory;
+		typedef _shape_factory shape_factory, *shape_factory_ptr;
+	}
+}
+
+#endif // LUNA_SHAPE_TYPE_H_
@@ -330,9 +330,519 @@ exit:
 			return result.str();
 		}
 
+		_token_table::_token_table(void) :
+			m_buffer(NULL)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_token_table::_token_table(
+			__in const _token_table &other
+			) :
+				m_atom(other.m_atom),
+				m_buffer(other.m_buffer),
+				m_line(other.m_line),
+				m_source(other.m_source),
+				m_subtype(other.m_subtype),
+				m_text_length(other.m_text_length),
+				m_text_offset(other.m_text_offset),
+				m_text_pool(other.m_text_pool),
+				m_type(other.m_type),
+				m_value(other.m_value)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_token_table::~_token_table(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_token_table &
+		_token_table::operator=(
+			__in const _token_table &other
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(this != &other) {
+				m_atom = other.m_atom;
+				m_buffer = other.m_buffer;
+				m_line = other.m_line;
+				m_source = other.m_source;
+				m_subtype = other.m_subtype;
+				m_text_length = other.m_text_length;
+				m_text_offset = other.m_text_offset;
+				m_text_pool = other.m_text_pool;
+				m_type = other.m_type;
+				m_value = other.m_value;
+			}
+
+			TRACE_EXIT("Return Value: 0x%p", this);
+			return *this;
+		}
+
+		size_t 
+		_token_table::add_token(
+			__in_opt token_t type,
+			__in_opt uint32_t subtype,
+			__in_opt const std::string &text,
+			__in_opt size_t line,
+			__in_opt double value,
+			__in_opt atom_t atom
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_type.size();
+			m_atom.push_back(atom);
+			m_line.push_back(line);
+			m_subtype.push_back(subtype);
+			m_text_length.push_back(text.size());
+			m_text_offset.push_back(text.empty() ? 0 : (m_text_pool.size() | TOKEN_TEXT_POOLED));
+			m_type.push_back(type);
+			m_value.push_back(value);
+			m_text_pool.append(text);
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_token_table::add_token_slice(
+			__in token_t type,
+			__in uint32_t subtype,
+			__in size_t offset,
+			__in size_t length,
+			__in_opt size_t line,
+			__in_opt double value,
+			__in_opt atom_t atom
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_buffer || (offset & TOKEN_TEXT_POOLED) 
+					|| ((offset + length) > m_buffer->size())) {
+				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_INVALID_SLICE,
+					"off/len: %lu/%lu", offset, length);
+			}
+
+			result = m_type.size();
+			m_atom.push_back(atom);
+			m_line.push_back(line);
+			m_subtype.push_back(subtype);
+			m_text_length.push_back(length);
+			m_text_offset.push_back(offset);
+			m_type.push_back(type);
+			m_value.push_back(value);
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_token_table::check_row(
+			__in size_t row
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(row >= m_type.size()) {
+				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_INVALID_ROW,
+					"row/max: %lu/%lu", row, m_type.size());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_table::clear(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_atom.clear();
+			m_buffer = NULL;
+			m_line.clear();
+			m_source.clear();
+			m_subtype.clear();
+			m_text_length.clear();
+			m_text_offset.clear();
+			m_text_pool.clear();
+			m_type.clear();
+			m_value.clear();
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		atom_t 
+		_token_table::get_atom(
+			__in size_t row
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			TRACE_EXIT("Return Value: 0x%x", m_atom[row]);
+			return m_atom[row];
+		}
+
+		const std::string *
+		_token_table::get_buffer(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%p", m_buffer);
+			return m_buffer;
+		}
+
+		size_t 
+		_token_table::get_line(
+			__in size_t row
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			TRACE_EXIT("Return Value: %lu", m_line[row]);
+			return m_line[row];
+		}
+
+		std::string &
+		_token_table::get_source(void)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: %s", m_source.c_str());
+			return m_source;
+		}
+
+		uint32_t 
+		_token_table::get_subtype(
+			__in size_t row
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			TRACE_EXIT("Return Value: 0x%x", m_subtype[row]);
+			return m_subtype[row];
+		}
+
+		std::string 
+		_token_table::get_text(
+			__in size_t row
+			)
+		{
+			std::string result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			if(m_text_length[row]) {
+
+				if(m_text_offset[row] & TOKEN_TEXT_POOLED) {
+					result = m_text_pool.substr(m_text_offset[row] & ~TOKEN_TEXT_POOLED, m_text_length[row]);
+				} else if(m_buffer) {
+					result = m_buffer->substr(m_text_offset[row], m_text_length[row]);
+				} else {
+					THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_INVALID_SLICE,
+						"off/len: %u/%u", m_text_offset[row], m_text_length[row]);
+				}
+			}
+
+			TRACE_EXIT("Return Value: %s", result.c_str());
+			return result;
+		}
+
+		token_t 
+		_token_table::get_type(
+			__in size_t row
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			TRACE_EXIT("Return Value: 0x%x", m_type[row]);
+			return (token_t) m_type[row];
+		}
+
+		double 
+		_token_table::get_value(
+			__in size_t row
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			TRACE_EXIT("Return Value: %f", m_value[row]);
+			return m_value[row];
+		}
+
+		bool 
+		_token_table::has_text(
+			__in size_t row
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+			result = (m_text_length[row] != 0);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_token_table::load(
+			__in image_reader &reader
+			)
+		{
+			size_t limit, offset, row;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			reader.read_list(m_atom);
+			reader.read_list(m_line);
+			reader.read_list(m_subtype);
+			reader.read_list(m_text_length);
+			reader.read_list(m_text_offset);
+			reader.read_string(m_text_pool);
+			reader.read_list(m_type);
+			reader.read_list(m_value);
+
+			if((m_line.size() != m_atom.size()) || (m_subtype.size() != m_atom.size())
+					|| (m_text_length.size() != m_atom.size()) || (m_text_offset.size() != m_atom.size())
+					|| (m_type.size() != m_atom.size()) || (m_value.size() != m_atom.size())) {
+				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_INVALID_IMAGE,
+					"rows: %lu", m_atom.size());
+			}
+
+			for(row = 0; row < m_atom.size(); ++row) {
+
+				if(m_text_offset[row] & TOKEN_TEXT_POOLED) {
+					limit = m_text_pool.size();
+					offset = (m_text_offset[row] & ~TOKEN_TEXT_POOLED);
+				} else {
+					limit = (m_buffer ? m_buffer->size() : 0);
+					offset = m_text_offset[row];
+				}
+
+				if(m_text_length[row] && ((offset > limit) || (m_text_length[row] > (limit - offset)))) {
+					THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_INVALID_IMAGE,
+						"row/off/len: %lu/%lu/%u", row, offset, m_text_length[row]);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_table::reserve(
+			__in size_t count
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_atom.reserve(count);
+			m_line.reserve(count);
+			m_subtype.reserve(count);
+			m_text_length.reserve(count);
+			m_text_offset.reserve(count);
+			m_type.reserve(count);
+			m_value.reserve(count);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_table::save(
+			__in image_writer &writer
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			writer.write_list(m_atom);
+			writer.write_list(m_line);
+			writer.write_list(m_subtype);
+			writer.write_list(m_text_length);
+			writer.write_list(m_text_offset);
+			writer.write_string(m_text_pool);
+			writer.write_list(m_type);
+			writer.write_list(m_value);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_table::set_atom(
+			__in size_t row,
+			__in atom_t atom
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+			m_atom[row] = atom;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_table::set_buffer(
+			__in const std::string *buffer
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_buffer = buffer;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_table::set_source(
+			__in const std::string &source
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			m_source = source;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_token_table::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_type.size();
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		std::string 
+		_token_table::to_string(
+			__in_opt bool verbose
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "Entries: " << m_type.size();
+
+			if(verbose) {
+				result << ", Pooled text: " << m_text_pool.size() << " bytes";
+
+				if(!m_source.empty()) {
+					result << ", Source: " << m_source;
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
+		std::string 
+		_token_table::token_as_string(
+			__in size_t row,
+			__in_opt bool verbose
+			)
+		{
+			token_t type;
+			std::stringstream result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			check_row(row);
+
+			type = (token_t) m_type[row];
+
+			if(verbose) {
+				result << "{" << row << "} ";
+			}
+
+			result << "[" << TOKEN_STRING(type);
+
+			if(m_subtype[row] != TOKEN_SUBTYPE_INVALID) {
+				result << ", " << token::find_subtype_string(type, m_subtype[row]);
+			}
+
+			result << "]";
+
+			if(m_text_length[row]) {
+				result << " \"" << get_text(row) << "\"";
+			} else if(type == TOKEN_LITERAL_STRING) {
+				result << " \"\"";
+			}
+
+			switch(type) {
+				case TOKEN_FLOAT:
+				case TOKEN_SCALAR:
+					result << " (" << m_value[row] << ")";
+					break;
+				case TOKEN_LITERAL_CHARACTER:
+					result << " \'" << (isprint((uint8_t) m_value[row]) ? ((char) m_value[row]) : ' ') << "\' " 
+						<< "(0x" << VALUE_AS_HEX(uint8_t, m_value[row]) << ")";
+					break;
+				case TOKEN_LITERAL_STRING:
+					result << " (" << m_text_length[row] << ")";
+					break;
+			}
+
+			if(!m_source.empty() && (m_line[row] != TOKEN_LINE_INVALID)) {
+				result << " (" << m_source << "(" << m_line[row] << "))";
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+
 		_token_factory::_token_factory(
 			__in_opt generic_cb_t dest
-			)
+			) :
+				m_id_mapping(HANDLE_ID_MAPPING_DEFAULT),
+				m_initialized(false)
 		{
 			TRACE_ENTRY();
 
@@ -377,12 +887,15 @@ exit:
 			return result;
 		}
 
-		void 
+		handle_t 
 		_token_factory::add_token(
 			__in const uuid &id,
 			__in const token &tok
 			)
 		{
+			uint32_t slot;
+			handle_t result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -390,19 +903,36 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			if(m_token_map.find(id) != m_token_map.end()) {
+			if(m_id_mapping && (m_id_map.find(id) != m_id_map.end())) {
 				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_ID_ALREADY_ADDED,
 					"%s", uuid::id_as_string(id).c_str());
 			}
 
-			m_token_map.insert(std::pair<uuid, token>(id, tok));
+			result = m_handle_table.allocate();
+			slot = HANDLE_SLOT(result);
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+			if(slot >= m_token_list.size()) {
+				m_token_list.resize(slot + 1, NULL);
+			}
+
+			m_token_list.at(slot) = new token(tok);
+			if(!m_token_list.at(slot)) {
+				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_ALLOC_FAILED);
+			}
+
+			if(m_id_mapping) {
+				m_id_map.insert(std::pair<uuid, handle_t>(id, result));
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
 		}
 
 		void 
 		_token_factory::clear(void)
 		{
+			std::vector<token_ptr>::iterator tok_iter;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -410,7 +940,16 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_token_map.clear();
+			for(tok_iter = m_token_list.begin(); tok_iter != m_token_list.end(); ++tok_iter) {
+
+				if(*tok_iter) {
+					delete *tok_iter;
+				}
+			}
+
+			m_token_list.clear();
+			m_handle_table.clear();
+			m_id_map.clear();
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -429,12 +968,12 @@ exit:
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		std::map<uuid, token>::iterator 
-		_token_factory::find_token(
+		std::unordered_map<uuid, handle_t>::iterator 
+		_token_factory::find_handle(
 			__in const uuid &id
 			)
 		{
-			std::map<uuid, token>::iterator result;
+			std::unordered_map<uuid, handle_t>::iterator result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -443,8 +982,13 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_token_map.find(id);
-			if(result == m_token_map.end()) {
+			if(!m_id_mapping) {
+				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_ID_UNMAPPED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = m_id_map.find(id);
+			if(result == m_id_map.end()) {
 				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_ID_NOT_FOUND,
 					"%s", uuid::id_as_string(id).c_str());
 			}
@@ -453,13 +997,34 @@ exit:
 			return result;
 		}
 
-		token &
+		token_ptr 
+		_token_factory::find_token(
+			__in handle_t handle
+			)
+		{
+			token_ptr result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_token_list[m_handle_table.get_slot(handle)];
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		handle_t 
 		_token_factory::generate(
 			__in_opt token_t type,
 			__in_opt uint32_t subtype
 			)
 		{
 			token tok;
+			handle_t result;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -469,10 +1034,37 @@ exit:
 			}
 
 			tok.set_type(type, subtype);
-			add_token(tok.get_id(), tok);
+			result = add_token(tok.get_id(), tok);
+
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		handle_t 
+		_token_factory::get_handle(
+			__in const uuid &id
+			)
+		{
+			handle_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = find_handle(id)->second;
 
+			TRACE_EXIT("Return Value: 0x%llx", result);
+			return result;
+		}
+
+		token &
+		_token_factory::get_token(
+			__in handle_t handle
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_token(tok.get_id())->second;
+			return *find_token(handle);
 		}
 
 		token &
@@ -480,6 +1072,19 @@ exit:
 			__in const uuid &id
 			)
 		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return *find_token(find_handle(id)->second);
+		}
+
+		bool 
+		_token_factory::has_token(
+			__in handle_t handle
+			)
+		{
+			bool result;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -487,8 +1092,10 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			TRACE_EXIT("Return Value: 0x%x", NULL);
-			return find_token(id)->second;
+			result = m_handle_table.is_valid(handle);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		bool 
@@ -505,24 +1112,46 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = (m_token_map.find(id) != m_token_map.end());
+			if(!m_id_mapping) {
+				THROW_LUNA_TOKEN_EXCEPTION_MESSAGE(LUNA_TOKEN_EXCEPTION_ID_UNMAPPED,
+					"%s", uuid::id_as_string(id).c_str());
+			}
+
+			result = (m_id_map.find(id) != m_id_map.end());
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
 		void 
-		_token_factory::initialize(void)
+		_token_factory::initialize(
+			__in_opt bool id_mapping
+			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			destroy();
+			m_id_mapping = id_mapping;
 			m_initialized = true;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
+		bool 
+		_token_factory::is_id_mapped(void)
+		{
+			bool result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_id_mapping;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
 		bool 
 		_token_factory::is_initialized(void)
 		{
@@ -539,9 +1168,11 @@ exit:
 
 		void 
 		_token_factory::remove_token(
-			__in const uuid &id
+			__in handle_t handle
 			)
 		{
+			uint32_t slot;
+
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -549,7 +1180,28 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_token_map.erase(find_token(id));
+			slot = m_handle_table.get_slot(handle);
+
+			if(m_id_mapping) {
+				m_id_map.erase(m_token_list.at(slot)->get_id());
+			}
+
+			delete m_token_list.at(slot);
+			m_token_list.at(slot) = NULL;
+			m_handle_table.release(handle);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_token_factory::remove_token(
+			__in const uuid &id
+			)
+		{
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			remove_token(find_handle(id)->second);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -566,9 +1218,9 @@ exit:
 				THROW_LUNA_TOKEN_EXCEPTION(LUNA_TOKEN_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_token_map.size();
+			result = m_handle_table.size();
 
-			TRACE_EXIT("Return Value: 0x%x", result);
+			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
@@ -578,7 +1230,7 @@ exit:
 			)
 		{
 			std::stringstream result;
-			std::map<uuid, token>::iterator tok_iter;
+			std::vector<token_ptr>::iterator tok_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -591,10 +1243,18 @@ exit:
 				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
 			}
 
-			result << "Entries: " << m_token_map.size();
+			result << "Entries: " << m_handle_table.size();
+
+			if(verbose) {
+				result << ", " << m_handle_table.to_string(verbose) << ", UUID mapping: " 
+					<< (m_id_mapping ? "on" : "off");
+			}
 			
-			for(tok_iter = m_token_map.begin(); tok_iter != m_token_map.end(); ++tok_iter) {
-				result << std::endl << tok_iter->second.to_string(verbose);
+			for(tok_iter = m_token_list.begin(); tok_iter != m_token_list.end(); ++tok_iter) {
+
+				if(*tok_iter) {
+					result << std::endl << (*tok_iter)->to_string(verbose);
+				}
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
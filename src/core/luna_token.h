@@ -26,7 +26,9 @@ namespace LUNA_NS {
 
 	namespace LUNA_COMP_NS {
 
+		#define TOKEN_LINE_INVALID ((uint32_t) INVALID)
 		#define TOKEN_SUBTYPE_INVALID ((uint32_t) INVALID)
+		#define TOKEN_TEXT_POOLED 0x80000000
 
 		typedef class _token :
 				public uuid_base {
@@ -90,6 +92,8 @@ namespace LUNA_NS {
 
 			protected:
 
+				friend class _token_table;
+
 				static std::string find_subtype_string(
 					__in token_t &type,
 					__in uint32_t subtype
@@ -113,6 +117,143 @@ namespace LUNA_NS {
 
 		} token, *token_ptr;
 
+		typedef class _token_table {
+
+			public:
+
+				_token_table(void);
+
+				_token_table(
+					__in const _token_table &other
+					);
+
+				virtual ~_token_table(void);
+
+				_token_table &operator=(
+					__in const _token_table &other
+					);
+
+				size_t add_token(
+					__in_opt token_t type = TOKEN_BEGIN,
+					__in_opt uint32_t subtype = TOKEN_SUBTYPE_INVALID,
+					__in_opt const std::string &text = std::string(),
+					__in_opt size_t line = TOKEN_LINE_INVALID,
+					__in_opt double value = 0,
+					__in_opt atom_t atom = ATOM_INVALID
+					);
+
+				size_t add_token_slice(
+					__in token_t type,
+					__in uint32_t subtype,
+					__in size_t offset,
+					__in size_t length,
+					__in_opt size_t line = TOKEN_LINE_INVALID,
+					__in_opt double value = 0,
+					__in_opt atom_t atom = ATOM_INVALID
+					);
+
+				void clear(void);
+
+				atom_t get_atom(
+					__in size_t row
+					);
+
+				const std::string *get_buffer(void);
+
+				size_t get_line(
+					__in size_t row
+					);
+
+				std::string &get_source(void);
+
+				uint32_t get_subtype(
+					__in size_t row
+					);
+
+				std::string get_text(
+					__in size_t row
+					);
+
+				token_t get_type(
+					__in size_t row
+					);
+
+				double get_value(
+					__in size_t row
+					);
+
+				bool has_text(
+					__in size_t row
+					);
+
+				void load(
+					__in image_reader &reader
+					);
+
+				void reserve(
+					__in size_t count
+					);
+
+				void save(
+					__in image_writer &writer
+					);
+
+				void set_atom(
+					__in size_t row,
+					__in atom_t atom
+					);
+
+				void set_buffer(
+					__in const std::string *buffer
+					);
+
+				void set_source(
+					__in const std::string &source
+					);
+
+				size_t size(void);
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+				std::string token_as_string(
+					__in size_t row,
+					__in_opt bool verbose = false
+					);
+
+			protected:
+
+				void check_row(
+					__in size_t row
+					);
+
+				std::vector<atom_t> m_atom;
+
+				const std::string *m_buffer;
+
+				std::vector<uint32_t> m_line;
+
+				std::string m_source;
+
+				std::vector<uint32_t> m_subtype;
+
+				std::vector<uint32_t> m_text_length;
+
+				std::vector<uint32_t> m_text_offset;
+
+				std::string m_text_pool;
+
+				std::vector<uint8_t> m_type;
+
+				std::vector<double> m_value;
+
+			private:
+
+				std::recursive_mutex m_lock;
+
+		} token_table, *token_table_ptr;
+
 		void token_factory_destroy(void);
 
 		typedef class _token_factory {
@@ -123,7 +264,7 @@ namespace LUNA_NS {
 					__in_opt generic_cb_t dest = NULL
 					);
 
-				void add_token(
+				handle_t add_token(
 					__in const uuid &id,
 					__in const token &tok
 					);
@@ -132,23 +273,43 @@ namespace LUNA_NS {
 
 				void destroy(void);
 
-				token &generate(
+				handle_t generate(
 					__in_opt token_t type = TOKEN_BEGIN,
 					__in_opt uint32_t subtype = TOKEN_SUBTYPE_INVALID
 					);
 
+				handle_t get_handle(
+					__in const uuid &id
+					);
+
+				token &get_token(
+					__in handle_t handle
+					);
+
 				token &get_token(
 					__in const uuid &id
 					);
 
+				bool has_token(
+					__in handle_t handle
+					);
+
 				bool has_token(
 					__in const uuid &id
 					);
 
-				void initialize(void);
+				void initialize(
+					__in_opt bool id_mapping = HANDLE_ID_MAPPING_DEFAULT
+					);
+
+				bool is_id_mapped(void);
 
 				bool is_initialized(void);
 
+				void remove_token(
+					__in handle_t handle
+					);
+
 				void remove_token(
 					__in const uuid &id
 					);
@@ -177,15 +338,25 @@ namespace LUNA_NS {
 					__in _token_factory &other
 					);
 
-				std::map<uuid, token>::iterator find_token(
+				std::unordered_map<uuid, handle_t>::iterator find_handle(
 					__in const uuid &id
 					);
 
+				token_ptr find_token(
+					__in handle_t handle
+					);
+
+				handle_table m_handle_table;
+
+				bool m_id_mapping;
+
+				std::unordered_map<uuid, handle_t> m_id_map;
+
 				bool m_initialized;
 
 				static _token_factory *m_instance;
 
-				std::map<uuid, token> m_token_map;
+				std::vector<token_ptr> m_token_list;
 
 			private:
 
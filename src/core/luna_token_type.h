@@ -28,6 +28,10 @@ namespace LUNA_NS {
 			LUNA_TOKEN_EXCEPTION_ALLOC_FAILED = 0,
 			LUNA_TOKEN_EXCEPTION_ID_ALREADY_ADDED,
 			LUNA_TOKEN_EXCEPTION_ID_NOT_FOUND,
+			LUNA_TOKEN_EXCEPTION_ID_UNMAPPED,
+			LUNA_TOKEN_EXCEPTION_INVALID_IMAGE,
+			LUNA_TOKEN_EXCEPTION_INVALID_ROW,
+			LUNA_TOKEN_EXCEPTION_INVALID_SLICE,
 			LUNA_TOKEN_EXCEPTION_UNINITIALIZED,
 		};
 
@@ -35,6 +39,10 @@ namespace LUNA_NS {
 			"Token factory allocation failed",
 			"Token UUID was already added",
 			"Token UUID was not found",
+			"Token UUID mapping is disabled",
+			"Invalid token table image",
+			"Invalid token table row",
+			"Invalid token text slice",
 			"Token factory is uninitialized",
 			};
 
@@ -50,6 +58,9 @@ namespace LUNA_NS {
 		class _token;
 		typedef _token token, *token_ptr;
 
+		class _token_table;
+		typedef _token_table token_table, *token_table_ptr;
+
 		class _token_factory;
 		typedef _token_factory token_factory, *token_factory_ptr;
 	}
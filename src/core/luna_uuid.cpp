@@ -24,25 +24,32 @@ namespace LUNA_NS {
 
 	namespace LUNA_COMP_NS {
 		
-		_uuid_factory *_uuid_factory::m_instance = NULL;
+		static const std::string UUID_REFERENCE_STR[] = {
+			"REGISTRY", "INTRUSIVE",
+			};
 
-		bool 
-		operator<(
-			__in const uuid &left,
-			__in const uuid &right
-			)
-		{
-			bool result = false;
+		#define UUID_REFERENCE_STRING(_TYPE_)\
+			((_TYPE_) > UUID_REFERENCE_MAX ? UNKNOWN : UUID_REFERENCE_STR[_TYPE_].c_str())
 
-			TRACE_ENTRY();
+		static const std::string UUID_REGISTRY_STR[] = {
+			"MAP", "SHARDED",
+			};
 
-			if(&left != &right) {
-				result = (left.m_block < right.m_block);
-			}
+		#define UUID_REGISTRY_STRING(_TYPE_)\
+			((_TYPE_) > UUID_REGISTRY_MAX ? UNKNOWN : UUID_REGISTRY_STR[_TYPE_].c_str())
 
-			TRACE_EXIT("Return Value: 0x%x", result);
-			return result;
-		}
+		static const std::string UUID_GENERATOR_STR[] = {
+			"RANDOM", "SEQUENTIAL",
+			};
+
+		#define UUID_GENERATOR_STRING(_TYPE_)\
+			((_TYPE_) > UUID_GENERATOR_MAX ? UNKNOWN : UUID_GENERATOR_STR[_TYPE_].c_str())
+
+		_uuid_factory *_uuid_factory::m_instance = NULL;
+
+		static thread_local uint64_t uuid_sequential_end = 0;
+		static thread_local uint32_t uuid_sequential_epoch = 0;
+		static thread_local uint64_t uuid_sequential_next = 0;
 
 		void 
 		uuid_factory_destroy(void)
@@ -58,7 +65,8 @@ namespace LUNA_NS {
 		}
 
 		_uuid::_uuid(void) :
-			m_block(0, 0)
+			m_high(0),
+			m_low(0)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -67,209 +75,776 @@ namespace LUNA_NS {
 		_uuid::_uuid(
 			__in const uuid_blk_t &block
 			) :
-				m_block(block)
+				m_high(block.first),
+				m_low(block.second)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		_uuid::_uuid(
+		bool 
+		_uuid::operator==(
 			__in const _uuid &other
-			) :
-				m_block(other.m_block)
+			) const
 		{
+			bool result;
+
 			TRACE_ENTRY();
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+
+			result = ((m_high == other.m_high) && (m_low == other.m_low));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
-		_uuid::~_uuid(void)
+		bool 
+		_uuid::operator!=(
+			__in const _uuid &other
+			) const
 		{
+			bool result;
+
 			TRACE_ENTRY();
-			TRACE_EXIT("Return Value: 0x%x", NULL);
+
+			result = ((m_high != other.m_high) || (m_low != other.m_low));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
-		_uuid &
-		_uuid::operator=(
+		bool 
+		_uuid::operator<(
 			__in const _uuid &other
-			)
+			) const
 		{
+			bool result;
+
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(this != &other) {
-				m_block = other.m_block;
-			}
+			result = ((m_high < other.m_high) || ((m_high == other.m_high) && (m_low < other.m_low)));
 
-			TRACE_EXIT("Return Value: 0x%p", this);
-			return *this;
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
 		}
 
 		bool 
-		_uuid::operator==(
+		_uuid::operator>(
 			__in const _uuid &other
-			)
+			) const
 		{
-			bool result = true;
+			bool result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(this != &other) {
-				result = (m_block == other.m_block);
-			}
+			result = (other < *this);
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
 		bool 
-		_uuid::operator!=(
+		_uuid::operator>=(
 			__in const _uuid &other
-			)
+			) const
 		{
 			bool result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = !(*this == other);
+			result = !(*this < other);
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
 		bool 
-		_uuid::operator<(
+		_uuid::operator<=(
 			__in const _uuid &other
+			) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = !(other < *this);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		void 
+		_uuid::clear(void)
+		{
+			TRACE_ENTRY();
+
+			m_high = 0;
+			m_low = 0;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		uuid_blk_t 
+		_uuid::get_id(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return uuid_blk_t(m_high, m_low);
+		}
+
+		size_t 
+		_uuid::hash(void) const
+		{
+			uint64_t result;
+
+			TRACE_ENTRY();
+
+			result = m_high ^ (m_low * 0x9e3779b97f4a7c15ULL);
+			result ^= (result >> 0x21);
+			result *= 0xff51afd7ed558ccdULL;
+			result ^= (result >> 0x21);
+			result *= 0xc4ceb9fe1a85ec53ULL;
+			result ^= (result >> 0x21);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return (size_t) result;
+		}
+
+		size_t 
+		_uuid::hash(
+			__in const uuid_blk_t &block
+			)
+		{
+			return uuid(block).hash();
+		}
+
+		std::string 
+		_uuid::id_as_string(
+			__in const uuid_blk_t &block
 			)
 		{
-			bool result = true;
+			std::stringstream result;
+
+			TRACE_ENTRY();
+
+			result << "{" << VALUE_AS_HEX(uint32_t, block.first >> 0x20) << "-" 
+				<< VALUE_AS_HEX(uint16_t, block.first >> 0x10) << "-"
+				<< VALUE_AS_HEX(uint16_t, block.first) << "-"
+				<< VALUE_AS_HEX(uint16_t, block.second >> 0x30) << "-"
+				<< VALUE_AS_HEX(uint16_t, block.second >> 0x20) 
+				<< VALUE_AS_HEX(uint32_t, block.second) << "}";
+
+			TRACE_EXIT("Return Value: %s", result.str().c_str());
+			return result.str();
+		}
+
+		std::string 
+		_uuid::id_as_string(
+			__in const _uuid &id
+			)
+		{
+			return id_as_string(id.get_id());
+		}
+
+		std::string 
+		_uuid::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			UNREF_PARAM(verbose);
+			return id_as_string(get_id());
+		}
+
+		_uuid_registry::_uuid_registry(
+			__in_opt uuid_reg_t type
+			) :
+				m_type(type)
+		{
+			size_t iter = 0;
+
+			TRACE_ENTRY();
+
+			if(m_type > UUID_REGISTRY_MAX) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_INVALID_REGISTRY,
+					"%lu", m_type);
+			}
+
+			for(; iter < UUID_REGISTRY_SHARD_COUNT; ++iter) {
+				m_shard_size[iter] = 0;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_uuid_registry::~_uuid_registry(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_uuid_registry::clear(void)
+		{
+			size_t iter = 0;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(this != &other) {
-				result = (m_block < other.m_block);
+			m_id_map.clear();
+
+			for(; iter < UUID_REGISTRY_SHARD_COUNT; ++iter) {
+				SERIALIZE_CALL(m_shard_lock[iter]);
+				m_shard_table[iter].clear();
+				m_shard_size[iter] = 0;
 			}
 
-			TRACE_EXIT("Return Value: 0x%x", result);
-			return result;
+			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		bool 
-		_uuid::operator>(
-			__in const _uuid &other
+		_uuid_registry::contains(
+			__in const uuid_blk_t &block
 			)
 		{
-			bool result = true;
+			size_t hsh, shard;
+			bool result = false;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(this != &other) {
-				result = (m_block > other.m_block);
+			if(m_type == UUID_REGISTRY_SHARDED) {
+				hsh = uuid::hash(block);
+				shard = hsh & (UUID_REGISTRY_SHARD_COUNT - 1);
+
+				SERIALIZE_CALL(m_shard_lock[shard]);
+
+				if(!m_shard_table[shard].empty()) {
+					result = (m_shard_table[shard].at(shard_find(shard, block, hsh)).second.first 
+						!= 0);
+				}
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+				result = (m_id_map.find(uuid(block)) != m_id_map.end());
 			}
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
 		}
 
-		bool 
-		_uuid::operator>=(
-			__in const _uuid &other
+		uuid_config_t 
+		_uuid_registry::find(
+			__in const uuid_blk_t &block
 			)
 		{
-			bool result;
+			uuid_config_t result(0, false);
+			size_t hsh, shard, slot;
+			std::map<uuid, uuid_config_t>::iterator id_iter;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = !(*this < other);
+			if(m_type == UUID_REGISTRY_SHARDED) {
+				hsh = uuid::hash(block);
+				shard = hsh & (UUID_REGISTRY_SHARD_COUNT - 1);
 
-			TRACE_EXIT("Return Value: 0x%x", result);
+				SERIALIZE_CALL(m_shard_lock[shard]);
+
+				if(!m_shard_table[shard].empty()) {
+					slot = shard_find(shard, block, hsh);
+					result = m_shard_table[shard].at(slot).second;
+				}
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+
+				id_iter = m_id_map.find(uuid(block));
+				if(id_iter != m_id_map.end()) {
+					result = id_iter->second;
+				}
+			}
+
+			if(!result.first) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_ID_NOT_FOUND, 
+					"%s", uuid::id_as_string(block).c_str());
+			}
+
+			TRACE_EXIT("Return Value: %lu", result.first);
 			return result;
 		}
 
-		bool 
-		_uuid::operator<=(
-			__in const _uuid &other
+		uuid_reg_t 
+		_uuid_registry::get_type(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", m_type);
+			return m_type;
+		}
+
+		size_t 
+		_uuid_registry::register_id(
+			__in const uuid_blk_t &block,
+			__in_opt bool unique
 			)
 		{
-			bool result;
+			size_t hsh, result = INIT_REF, shard;
+			std::map<uuid, uuid_config_t>::iterator id_iter;
+
+			TRACE_ENTRY();
+
+			if(m_type == UUID_REGISTRY_SHARDED) {
+				hsh = uuid::hash(block);
+				shard = hsh & (UUID_REGISTRY_SHARD_COUNT - 1);
+
+				SERIALIZE_CALL(m_shard_lock[shard]);
+				shard_reserve(shard, 1);
+				result = shard_insert(shard, block, hsh, unique);
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+
+				id_iter = m_id_map.find(uuid(block));
+				if(id_iter == m_id_map.end()) {
+					m_id_map.insert(std::pair<uuid, uuid_config_t>(uuid(block), 
+						uuid_config_t(INIT_REF, unique)));
+				} else if(id_iter->second.second) {
+					THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_UNIQUE_ID_REFERENCED,
+						"%s", uuid::id_as_string(block).c_str());
+				} else {
+					result = ++id_iter->second.first;
+				}
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_uuid_registry::register_range(
+			__in const uuid_blk_t &block,
+			__in size_t count,
+			__in_opt bool unique
+			)
+		{
+			size_t iter, shard;
+			std::map<uuid, uuid_config_t>::iterator id_iter;
+			std::vector<std::unique_lock<std::mutex>> lock_list;
+			std::vector<size_t> hash_list, offset_list, order_list;
 
+			TRACE_ENTRY();
+
+			if(m_type == UUID_REGISTRY_SHARDED) {
+				shard_partition(block, count, hash_list, order_list, offset_list);
+
+				for(shard = 0; shard < UUID_REGISTRY_SHARD_COUNT; ++shard) {
+
+					if(offset_list.at(shard) != offset_list.at(shard + 1)) {
+						lock_list.push_back(std::unique_lock<std::mutex>(m_shard_lock[shard]));
+					}
+				}
+
+				for(shard = 0; shard < UUID_REGISTRY_SHARD_COUNT; ++shard) {
+
+					if(m_shard_table[shard].empty()) {
+						continue;
+					}
+
+					for(iter = offset_list.at(shard); iter < offset_list.at(shard + 1); ++iter) {
+
+						uuid_reg_ent_t &entry = m_shard_table[shard].at(shard_find(shard, 
+							uuid_blk_t(block.first, block.second + order_list.at(iter)), 
+							hash_list.at(order_list.at(iter))));
+						if(entry.second.first && entry.second.second) {
+							THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_UNIQUE_ID_REFERENCED,
+								"%s", uuid::id_as_string(entry.first).c_str());
+						}
+					}
+				}
+
+				for(shard = 0; shard < UUID_REGISTRY_SHARD_COUNT; ++shard) {
+
+					if(offset_list.at(shard) == offset_list.at(shard + 1)) {
+						continue;
+					}
+
+					shard_reserve(shard, offset_list.at(shard + 1) - offset_list.at(shard));
+
+					for(iter = offset_list.at(shard); iter < offset_list.at(shard + 1); ++iter) {
+						shard_insert(shard, uuid_blk_t(block.first, block.second + order_list.at(iter)), 
+							hash_list.at(order_list.at(iter)), unique);
+					}
+				}
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+
+				for(iter = 0; iter < count; ++iter) {
+
+					id_iter = m_id_map.find(uuid(uuid_blk_t(block.first, block.second + iter)));
+					if((id_iter != m_id_map.end()) && id_iter->second.second) {
+						THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_UNIQUE_ID_REFERENCED,
+							"%s", uuid::id_as_string(id_iter->first).c_str());
+					}
+				}
+
+				for(iter = 0; iter < count; ++iter) {
+					register_id(uuid_blk_t(block.first, block.second + iter), unique);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_uuid_registry::set_type(
+			__in uuid_reg_t type
+			)
+		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			result = !(*this > other);
+			if(type > UUID_REGISTRY_MAX) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_INVALID_REGISTRY,
+					"%lu", type);
+			}
 
-			TRACE_EXIT("Return Value: 0x%x", result);
+			clear();
+			m_type = type;
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_uuid_registry::shard_find(
+			__in size_t shard,
+			__in const uuid_blk_t &block,
+			__in size_t hash
+			)
+		{
+			size_t mask, result;
+
+			TRACE_ENTRY();
+
+			std::vector<uuid_reg_ent_t> &table = m_shard_table[shard];
+			mask = (table.size() - 1);
+
+			for(result = ((hash >> UUID_REGISTRY_SHARD_SHIFT) & mask);; result = ((result + 1) & mask)) {
+
+				uuid_reg_ent_t &entry = table[result];
+				if(!entry.second.first || (entry.first == block)) {
+					break;
+				}
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		size_t 
+		_uuid_registry::shard_insert(
+			__in size_t shard,
+			__in const uuid_blk_t &block,
+			__in size_t hash,
+			__in_opt bool unique
+			)
+		{
+			size_t result = INIT_REF;
+
+			TRACE_ENTRY();
+
+			uuid_reg_ent_t &entry = m_shard_table[shard].at(shard_find(shard, block, hash));
+			if(!entry.second.first) {
+				entry = uuid_reg_ent_t(block, uuid_config_t(INIT_REF, unique));
+				++m_shard_size[shard];
+			} else if(entry.second.second) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_UNIQUE_ID_REFERENCED,
+					"%s", uuid::id_as_string(block).c_str());
+			} else {
+				result = ++entry.second.first;
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
+		}
+
+		void 
+		_uuid_registry::shard_partition(
+			__in const uuid_blk_t &block,
+			__in size_t count,
+			__inout std::vector<size_t> &hash_list,
+			__inout std::vector<size_t> &order_list,
+			__inout std::vector<size_t> &offset_list
+			)
+		{
+			size_t iter;
+			std::vector<size_t> position_list;
+
+			TRACE_ENTRY();
+
+			hash_list.resize(count);
+			order_list.resize(count);
+			offset_list.assign(UUID_REGISTRY_SHARD_COUNT + 1, 0);
+
+			for(iter = 0; iter < count; ++iter) {
+				hash_list.at(iter) = uuid::hash(uuid_blk_t(block.first, block.second + iter));
+				++offset_list.at((hash_list.at(iter) & (UUID_REGISTRY_SHARD_COUNT - 1)) + 1);
+			}
+
+			for(iter = 1; iter <= UUID_REGISTRY_SHARD_COUNT; ++iter) {
+				offset_list.at(iter) += offset_list.at(iter - 1);
+			}
+
+			position_list.assign(offset_list.begin(), offset_list.end() - 1);
+
+			for(iter = 0; iter < count; ++iter) {
+				order_list.at(position_list.at(hash_list.at(iter) & (UUID_REGISTRY_SHARD_COUNT - 1))++) = iter;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		size_t 
+		_uuid_registry::shard_remove(
+			__in size_t shard,
+			__in const uuid_blk_t &block,
+			__in size_t hash
+			)
+		{
+			size_t home, mask, next, result = 0, slot = 0;
+
+			TRACE_ENTRY();
+
+			std::vector<uuid_reg_ent_t> &table = m_shard_table[shard];
+			if(!table.empty()) {
+				slot = shard_find(shard, block, hash);
+			}
+
+			if(table.empty() || !table.at(slot).second.first) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_ID_NOT_FOUND,
+					"%s", uuid::id_as_string(block).c_str());
+			}
+
+			if(table.at(slot).second.first != INIT_REF) {
+				result = --table.at(slot).second.first;
+			} else {
+				mask = (table.size() - 1);
+
+				for(next = ((slot + 1) & mask); table.at(next).second.first; 
+						next = ((next + 1) & mask)) {
+					home = ((uuid::hash(table.at(next).first) >> UUID_REGISTRY_SHARD_SHIFT) & mask);
+
+					if(((next > slot) && ((home <= slot) || (home > next)))
+							|| ((next < slot) && ((home <= slot) && (home > next)))) {
+						table.at(slot) = table.at(next);
+						slot = next;
+					}
+				}
+
+				table.at(slot).second = uuid_config_t(0, false);
+				--m_shard_size[shard];
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
 		void 
-		_uuid::clear(void)
+		_uuid_registry::shard_reserve(
+			__in size_t shard,
+			__in size_t count
+			)
+		{
+			size_t capacity;
+
+			TRACE_ENTRY();
+
+			capacity = m_shard_table[shard].size();
+			if(((m_shard_size[shard] + count) * 4) > (capacity * 3)) {
+
+				if(!capacity) {
+					capacity = UUID_REGISTRY_SHARD_CAPACITY;
+				}
+
+				while(((m_shard_size[shard] + count) * 4) > (capacity * 3)) {
+					capacity *= 2;
+				}
+
+				shard_resize(shard, capacity);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_uuid_registry::shard_resize(
+			__in size_t shard,
+			__in size_t capacity
+			)
 		{
+			std::vector<uuid_reg_ent_t>::iterator entry_iter;
+			std::vector<uuid_reg_ent_t> table(capacity, uuid_reg_ent_t(uuid_blk_t(0, 0), 
+				uuid_config_t(0, false)));
+
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			m_block = uuid_blk_t(0, 0);
+			m_shard_table[shard].swap(table);
+
+			for(entry_iter = table.begin(); entry_iter != table.end(); ++entry_iter) {
+
+				if(entry_iter->second.first) {
+					m_shard_table[shard].at(shard_find(shard, entry_iter->first, 
+						uuid::hash(entry_iter->first))) = *entry_iter;
+				}
+			}
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		uuid_blk_t &
-		_uuid::get_id(void)
+		size_t 
+		_uuid_registry::size(void)
 		{
+			size_t iter = 0, result = 0;
+
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT("Return Value: 0x%p", &m_block);
-			return m_block;
+
+			if(m_type == UUID_REGISTRY_SHARDED) {
+
+				for(; iter < UUID_REGISTRY_SHARD_COUNT; ++iter) {
+					SERIALIZE_CALL(m_shard_lock[iter]);
+					result += m_shard_size[iter];
+				}
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+				result = m_id_map.size();
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
 		}
 
 		std::string 
-		_uuid::id_as_string(
-			__in const uuid_blk_t &block
+		_uuid_registry::to_string(
+			__in_opt bool verbose
 			)
 		{
+			size_t iter = 0;
 			std::stringstream result;
+			std::map<uuid, uuid_config_t>::iterator id_iter;
+			std::vector<uuid_reg_ent_t>::iterator entry_iter;
 
 			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
 
-			result << "{" << VALUE_AS_HEX(uint32_t, block.first >> 0x20) << "-" 
-				<< VALUE_AS_HEX(uint16_t, block.first >> 0x10) << "-"
-				<< VALUE_AS_HEX(uint16_t, block.first) << "-"
-				<< VALUE_AS_HEX(uint16_t, block.second >> 0x30) << "-"
-				<< VALUE_AS_HEX(uint16_t, block.second >> 0x20) 
-				<< VALUE_AS_HEX(uint32_t, block.second) << "}";
+			result << "Registry: " << UUID_REGISTRY_STRING(m_type);
 
-			TRACE_EXIT("Return Value: %s", result.str().c_str());
+			if(!verbose) {
+				goto exit;
+			}
+
+			if(m_type == UUID_REGISTRY_SHARDED) {
+
+				for(; iter < UUID_REGISTRY_SHARD_COUNT; ++iter) {
+					SERIALIZE_CALL(m_shard_lock[iter]);
+
+					for(entry_iter = m_shard_table[iter].begin(); 
+							entry_iter != m_shard_table[iter].end(); ++entry_iter) {
+
+						if(entry_iter->second.first) {
+							result << std::endl << "(" << (entry_iter->second.second ? std::string() : "non-") 
+								<< "unique, ref. " << entry_iter->second.first << ") " 
+								<< uuid::id_as_string(entry_iter->first);
+						}
+					}
+				}
+			} else {
+
+				for(id_iter = m_id_map.begin(); id_iter != m_id_map.end(); ++id_iter) {
+					result << std::endl << "(" << (id_iter->second.second ? std::string() : "non-") 
+						<< "unique, ref. " << id_iter->second.first << ") " 
+						<< uuid::id_as_string(id_iter->first);
+				}
+			}
+
+exit:
+			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
 		}
 
-		std::string 
-		_uuid::id_as_string(
-			__in const _uuid &id
+		size_t 
+		_uuid_registry::unregister_id(
+			__in const uuid_blk_t &block
 			)
 		{
-			return id_as_string(id.m_block);
+			size_t hsh, result = 0, shard;
+			std::map<uuid, uuid_config_t>::iterator id_iter;
+
+			TRACE_ENTRY();
+
+			if(m_type == UUID_REGISTRY_SHARDED) {
+				hsh = uuid::hash(block);
+				shard = hsh & (UUID_REGISTRY_SHARD_COUNT - 1);
+
+				SERIALIZE_CALL(m_shard_lock[shard]);
+				result = shard_remove(shard, block, hsh);
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+
+				id_iter = m_id_map.find(uuid(block));
+				if(id_iter == m_id_map.end()) {
+					THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_ID_NOT_FOUND,
+						"%s", uuid::id_as_string(block).c_str());
+				} else if(id_iter->second.first == INIT_REF) {
+					m_id_map.erase(id_iter);
+				} else {
+					result = --id_iter->second.first;
+				}
+			}
+
+			TRACE_EXIT("Return Value: %lu", result);
+			return result;
 		}
 
-		std::string 
-		_uuid::to_string(
-			__in_opt bool verbose
+		void 
+		_uuid_registry::unregister_range(
+			__in const uuid_blk_t &block,
+			__in size_t count
 			)
 		{
+			size_t iter, shard;
+			std::vector<size_t> hash_list, offset_list, order_list;
+
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_type == UUID_REGISTRY_SHARDED) {
+				shard_partition(block, count, hash_list, order_list, offset_list);
+
+				for(shard = 0; shard < UUID_REGISTRY_SHARD_COUNT; ++shard) {
+
+					if(offset_list.at(shard) == offset_list.at(shard + 1)) {
+						continue;
+					}
+
+					SERIALIZE_CALL(m_shard_lock[shard]);
+
+					for(iter = offset_list.at(shard); iter < offset_list.at(shard + 1); ++iter) {
+						shard_remove(shard, uuid_blk_t(block.first, block.second + order_list.at(iter)), 
+							hash_list.at(order_list.at(iter)));
+					}
+				}
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+
+				for(iter = 0; iter < count; ++iter) {
+					unregister_id(uuid_blk_t(block.first, block.second + iter));
+				}
+			}
+
 			TRACE_EXIT("Return Value: 0x%x", NULL);
-			UNREF_PARAM(verbose);
-			return id_as_string(m_block);
 		}
 
 		_uuid_factory::_uuid_factory(
 			__in_opt generic_cb_t dest
 			) :
+				m_counter(0),
+				m_epoch(0),
+				m_generator_type(UUID_GENERATOR_RANDOM),
 				m_initialized(false),
+				m_reference_type(UUID_REFERENCE_INTRUSIVE),
 				m_seed(0)
 		{
 			TRACE_ENTRY();
@@ -326,7 +901,9 @@ namespace LUNA_NS {
 			}
 
 			m_generator.seed(m_seed);
-			m_id_map.clear();
+			m_counter = 0;
+			++m_epoch;
+			m_registry.clear();
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -345,31 +922,7 @@ namespace LUNA_NS {
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
-		std::map<uuid, uuid_config_t>::iterator 
-		_uuid_factory::find_id(
-			__in const uuid &id
-			)
-		{
-			std::map<uuid, uuid_config_t>::iterator result;
-
-			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = m_id_map.find(id);
-			if(result == m_id_map.end()) {
-				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_ID_NOT_FOUND, 
-					"%s", uuid::id_as_string(id).c_str());
-			}
-
-			TRACE_EXIT("Return Value: %lu", result);
-			return result;
-		}
-
-size_t 
+		size_t 
 		_uuid_factory::generate(
 			__inout uuid &id,
 			__in_opt bool unique
@@ -378,19 +931,24 @@ size_t
 			size_t result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			do {
-				id = uuid(generate_block());
+			if(m_generator_type == UUID_GENERATOR_SEQUENTIAL) {
+				id = uuid(generate_sequential_block());
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
 
-				if(!unique) {
-					break;
-				}
-			} while(is_registered(id));
+				do {
+					id = uuid(generate_block());
+
+					if(!unique) {
+						break;
+					}
+				} while(is_registered(id));
+			}
 
 			result = register_id(id);
 
@@ -433,6 +991,74 @@ size_t
 			return result;
 		}
 
+		uuid 
+		_uuid_factory::generate_range(
+			__in size_t count
+			)
+		{
+			uuid_blk_t block;
+
+			TRACE_ENTRY();
+
+			if(!m_initialized) {
+				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!count) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_INVALID_RANGE,
+					"%lu", count);
+			}
+
+			if(m_generator_type == UUID_GENERATOR_SEQUENTIAL) {
+				block = uuid_blk_t(m_seed, m_counter.fetch_add(count) + 1);
+			} else {
+				SERIALIZE_CALL_RECUR(m_lock);
+
+				do {
+					block = generate_block();
+				} while((block.second + count) < block.second);
+			}
+
+			m_registry.register_range(block, count);
+
+			TRACE_EXIT("Return Value: %s", uuid::id_as_string(block).c_str());
+			return uuid(block);
+		}
+
+		uuid_blk_t 
+		_uuid_factory::generate_sequential_block(void)
+		{
+			uuid_blk_t result;
+
+			TRACE_ENTRY();
+
+			if((uuid_sequential_epoch != m_epoch) 
+					|| (uuid_sequential_next == uuid_sequential_end)) {
+				uuid_sequential_epoch = m_epoch;
+				uuid_sequential_next = (m_counter.fetch_add(UUID_SEQUENTIAL_BLOCK) + 1);
+				uuid_sequential_end = (uuid_sequential_next + UUID_SEQUENTIAL_BLOCK);
+			}
+
+			result = uuid_blk_t(m_seed, uuid_sequential_next++);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result;
+		}
+
+		uuid_gen_t 
+		_uuid_factory::get_generator_type(void)
+		{
+			uuid_gen_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_generator_type;
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
 		size_t 
 		_uuid_factory::get_reference_count(
 			__in const uuid &id
@@ -441,29 +1067,66 @@ size_t
 			size_t result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = find_id(id)->second.first;
+			result = m_registry.find(id.get_id()).first;
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
+		uuid_ref_t 
+		_uuid_factory::get_reference_type(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", m_reference_type);
+			return m_reference_type;
+		}
+
+		uuid_reg_t 
+		_uuid_factory::get_registry_type(void)
+		{
+			uuid_reg_t result;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result = m_registry.get_type();
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
 		void 
 		_uuid_factory::initialize(
-			__in uint32_t seed
+			__in uint32_t seed,
+			__in_opt uuid_reg_t registry,
+			__in_opt uuid_gen_t generator,
+			__in_opt uuid_ref_t reference
 			)
 		{
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
+			if(generator > UUID_GENERATOR_MAX) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_INVALID_GENERATOR,
+					"%lu", generator);
+			}
+
+			if(reference > UUID_REFERENCE_MAX) {
+				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_INVALID_REFERENCE,
+					"%lu", reference);
+			}
+
 			destroy();
+			m_generator_type = generator;
+			m_reference_type = reference;
 			m_seed = seed;
 			m_generator.seed(seed);
+			m_registry.set_type(registry);
 			m_initialized = true;
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
@@ -491,13 +1154,12 @@ size_t
 			bool result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = (m_id_map.find(id) != m_id_map.end());
+			result = m_registry.contains(id.get_id());
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
@@ -511,13 +1173,12 @@ size_t
 			bool result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = find_id(id)->second.second;
+			result = m_registry.find(id.get_id()).second;
 
 			TRACE_EXIT("Return Value: 0x%x", result);
 			return result;
@@ -529,25 +1190,15 @@ size_t
 			__in_opt bool unique
 			)
 		{
-			size_t result = INIT_REF;
-			std::map<uuid, uuid_config_t>::iterator id_iter;
+			size_t result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			id_iter = m_id_map.find(id);
-			if(id_iter == m_id_map.end()) {
-				m_id_map.insert(std::pair<uuid, uuid_config_t>(id, uuid_config_t(INIT_REF, unique)));
-			} else if(id_iter->second.second) {
-				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_UNIQUE_ID_REFERENCED,
-					"%s", uuid::id_as_string(id).c_str());
-			} else {
-				result = ++id_iter->second.first;
-			}
+			result = m_registry.register_id(id.get_id(), unique);
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
@@ -559,13 +1210,12 @@ size_t
 			size_t result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_id_map.size();
+			result = m_registry.size();
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
@@ -577,7 +1227,6 @@ size_t
 			)
 		{
 			std::stringstream result;
-			std::map<uuid, uuid_config_t>::iterator id_iter;
 
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -590,13 +1239,10 @@ size_t
 				result << "(" << (m_initialized ? "initialized" : "uninitialized") << ") ";
 			}
 
-			result << "Entries: " << m_id_map.size() << ", Seed: 0x" << VALUE_AS_HEX(uint32_t, m_seed);
-			
-			for(id_iter = m_id_map.begin(); id_iter != m_id_map.end(); ++id_iter) {
-				result << std::endl << "(" << (id_iter->second.second ? std::string() : "non-") 
-					<< "unique, ref. " << id_iter->second.first << ") " 
-					<< uuid::id_as_string(id_iter->first);
-			}
+			result << "Entries: " << m_registry.size() << ", Seed: 0x" << VALUE_AS_HEX(uint32_t, m_seed)
+				<< ", Generator: " << UUID_GENERATOR_STRING(m_generator_type) << ", Reference: "
+				<< UUID_REFERENCE_STRING(m_reference_type) << ", " 
+				<< m_registry.to_string(true);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 			return result.str();
@@ -607,31 +1253,39 @@ size_t
 			__in const uuid &id
 			)
 		{
-			size_t result = 0;
-			std::map<uuid, uuid_config_t>::iterator id_iter;
+			size_t result;
 
 			TRACE_ENTRY();
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_initialized) {
 				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
 			}
 
-			id_iter = m_id_map.find(id);
-			if(id_iter == m_id_map.end()) {
-				THROW_LUNA_UUID_EXCEPTION_MESSAGE(LUNA_UUID_EXCEPTION_ID_NOT_FOUND,
-					"%s", uuid::id_as_string(id).c_str());
-			} else if(id_iter->second.first == INIT_REF) {
-				m_id_map.erase(id_iter);
-			} else {
-				result = --id_iter->second.first;
-			}
+			result = m_registry.unregister_id(id.get_id());
 
 			TRACE_EXIT("Return Value: %lu", result);
 			return result;
 		}
 
-		_uuid_base::_uuid_base(void)
+		void 
+		_uuid_factory::unregister_range(
+			__in const uuid &id,
+			__in size_t count
+			)
+		{
+			TRACE_ENTRY();
+
+			if(!m_initialized) {
+				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_registry.unregister_range(id.get_id(), count);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_uuid_base::_uuid_base(void) :
+			m_reference(NULL)
 		{
 			TRACE_ENTRY();
 
@@ -642,33 +1296,34 @@ size_t
 
 		_uuid_base::_uuid_base(
 			__in const _uuid_base &other
-			)
+			) :
+				m_id(other.m_id),
+				m_reference(other.m_reference)
 		{
 			uuid_factory_ptr uuid_inst;
 
 			TRACE_ENTRY();
 
-			uuid_inst = acquire_id_factory();
-			if(!uuid_inst) {
-				THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_ACQUIRY_FAILED);
+			if(m_reference) {
+				++(*m_reference);
+			} else {
+
+				uuid_inst = acquire_id_factory();
+				if(!uuid_inst) {
+					THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_ACQUIRY_FAILED);
+				}
+
+				uuid_inst->register_id(m_id);
 			}
-			
-			m_id = other.m_id;
-			uuid_inst->register_id(m_id);
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
 		_uuid_base::~_uuid_base(void)
 		{
-			uuid_factory_ptr uuid_inst;
-
 			TRACE_ENTRY();
 
-			uuid_inst = acquire_id_factory();
-			if(uuid_inst) {
-				uuid_inst->unregister_id(m_id);
-			}
+			release_id();
 
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
@@ -683,7 +1338,26 @@ size_t
 			TRACE_ENTRY();
 			SERIALIZE_CALL_RECUR(m_lock);
 
-			if(this != &other) {
+			if((this != &other) && (m_reference || other.m_reference)) {
+
+				if(other.m_reference) {
+					++(*other.m_reference);
+				}
+
+				release_id();
+				m_id = other.m_id;
+				m_reference = other.m_reference;
+
+				if(!m_reference) {
+
+					uuid_inst = acquire_id_factory();
+					if(!uuid_inst) {
+						THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_ACQUIRY_FAILED);
+					}
+
+					uuid_inst->register_id(m_id);
+				}
+			} else if(this != &other) {
 				
 				uuid_inst = acquire_id_factory();
 				if(!uuid_inst) {
@@ -743,6 +1417,42 @@ size_t
 
 			m_id = uuid_inst->generate();
 
+			if(uuid_inst->get_reference_type() == UUID_REFERENCE_INTRUSIVE) {
+
+				m_reference = new uuid_ref_cnt_t(INIT_REF);
+				if(!m_reference) {
+					THROW_LUNA_UUID_EXCEPTION(LUNA_UUID_EXCEPTION_ALLOC_FAILED);
+				}
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		void 
+		_uuid_base::release_id(void)
+		{
+			uuid_factory_ptr uuid_inst;
+
+			TRACE_ENTRY();
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_reference) {
+
+				if(--(*m_reference)) {
+					m_reference = NULL;
+					goto exit;
+				}
+
+				delete m_reference;
+				m_reference = NULL;
+			}
+
+			uuid_inst = acquire_id_factory();
+			if(uuid_inst) {
+				uuid_inst->unregister_id(m_id);
+			}
+
+exit:
 			TRACE_EXIT("Return Value: 0x%x", NULL);
 		}
 
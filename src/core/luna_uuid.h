@@ -20,8 +20,11 @@
 #ifndef LUNA_UUID_H_
 #define LUNA_UUID_H_
 
+#include <atomic>
 #include <map>
 #include <random>
+#include <unordered_map>
+#include <vector>
 
 namespace LUNA_NS {
 
@@ -29,6 +32,36 @@ namespace LUNA_NS {
 
 		typedef std::pair<uint64_t, uint64_t> uuid_blk_t, *uuid_blk_ptr_t;
 		typedef std::pair<size_t, bool> uuid_config_t, *uuid_config_ptr_t;
+		typedef std::pair<uuid_blk_t, uuid_config_t> uuid_reg_ent_t, *uuid_reg_ent_ptr_t;
+
+		typedef enum {
+			UUID_REGISTRY_MAP = 0,
+			UUID_REGISTRY_SHARDED,
+		} uuid_reg_t;
+
+		#define UUID_REGISTRY_MAX UUID_REGISTRY_SHARDED
+
+		typedef enum {
+			UUID_GENERATOR_RANDOM = 0,
+			UUID_GENERATOR_SEQUENTIAL,
+		} uuid_gen_t;
+
+		#define UUID_GENERATOR_MAX UUID_GENERATOR_SEQUENTIAL
+
+		#define UUID_SEQUENTIAL_BLOCK 0x400
+
+		typedef enum {
+			UUID_REFERENCE_REGISTRY = 0,
+			UUID_REFERENCE_INTRUSIVE,
+		} uuid_ref_t;
+
+		#define UUID_REFERENCE_MAX UUID_REFERENCE_INTRUSIVE
+
+		typedef std::atomic<size_t> uuid_ref_cnt_t, *uuid_ref_cnt_ptr_t;
+
+		#define UUID_REGISTRY_SHARD_CAPACITY 0x10
+		#define UUID_REGISTRY_SHARD_COUNT 0x40
+		#define UUID_REGISTRY_SHARD_SHIFT 0x06
 
 		typedef class _uuid {
 		
@@ -40,77 +73,178 @@ namespace LUNA_NS {
 					__in const uuid_blk_t &block
 					);
 
-				_uuid(
-					__in const _uuid &other
-					);
-
-				virtual ~_uuid(void);
-
-				_uuid &operator=(
-					__in const _uuid &other
-					);
-
 				bool operator==(
 					__in const _uuid &other
-					);
+					) const;
 
 				bool operator!=(
 					__in const _uuid &other
-					);
+					) const;
 
 				bool operator<(
 					__in const _uuid &other
-					);
+					) const;
 
 				bool operator>(
 					__in const _uuid &other
-					);
+					) const;
 
 				bool operator>=(
 					__in const _uuid &other
-					);
+					) const;
 
 				bool operator<=(
 					__in const _uuid &other
-					);
+					) const;
 
-				virtual void clear(void);
+				void clear(void);
 
-				uuid_blk_t &get_id(void);
+				uuid_blk_t get_id(void) const;
+
+				size_t hash(void) const;
+
+				static size_t hash(
+					__in const uuid_blk_t &block
+					);
 
 				static std::string id_as_string(
 					__in const _uuid &id
 					);
 
-				virtual std::string to_string(
+				std::string to_string(
 					__in_opt bool verbose = false
-					);
+					) const;
 
 			protected:
 
 				friend class _uuid_factory;
 
-				friend bool operator<(
-					__in const _uuid &left,
-					__in const _uuid &right
-					);
+				friend class _uuid_registry;
 
 				static std::string id_as_string(
 					__in const uuid_blk_t &block
 					);
 
-				uuid_blk_t m_block;
+				uint64_t m_high;
+
+				uint64_t m_low;
+
+		} uuid, *uuid_ptr;
+
+		typedef class _uuid_registry {
+		
+			public:
+
+				_uuid_registry(
+					__in_opt uuid_reg_t type = UUID_REGISTRY_SHARDED
+					);
+
+				virtual ~_uuid_registry(void);
+
+				void clear(void);
+
+				bool contains(
+					__in const uuid_blk_t &block
+					);
+
+				uuid_config_t find(
+					__in const uuid_blk_t &block
+					);
+
+				uuid_reg_t get_type(void);
+
+				size_t register_id(
+					__in const uuid_blk_t &block,
+					__in_opt bool unique = false
+					);
+
+				void register_range(
+					__in const uuid_blk_t &block,
+					__in size_t count,
+					__in_opt bool unique = false
+					);
+
+				void set_type(
+					__in uuid_reg_t type
+					);
+
+				size_t size(void);
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+				size_t unregister_id(
+					__in const uuid_blk_t &block
+					);
+
+				void unregister_range(
+					__in const uuid_blk_t &block,
+					__in size_t count
+					);
+
+			protected:
+
+				_uuid_registry(
+					__in const _uuid_registry &other
+					);
+
+				_uuid_registry &operator=(
+					__in const _uuid_registry &other
+					);
+
+				size_t shard_find(
+					__in size_t shard,
+					__in const uuid_blk_t &block,
+					__in size_t hash
+					);
+
+				size_t shard_insert(
+					__in size_t shard,
+					__in const uuid_blk_t &block,
+					__in size_t hash,
+					__in_opt bool unique = false
+					);
+
+				void shard_partition(
+					__in const uuid_blk_t &block,
+					__in size_t count,
+					__inout std::vector<size_t> &hash_list,
+					__inout std::vector<size_t> &order_list,
+					__inout std::vector<size_t> &offset_list
+					);
+
+				size_t shard_remove(
+					__in size_t shard,
+					__in const uuid_blk_t &block,
+					__in size_t hash
+					);
+
+				void shard_reserve(
+					__in size_t shard,
+					__in size_t count
+					);
+
+				void shard_resize(
+					__in size_t shard,
+					__in size_t capacity
+					);
+
+				std::map<uuid, uuid_config_t> m_id_map;
+
+				std::mutex m_shard_lock[UUID_REGISTRY_SHARD_COUNT];
+
+				size_t m_shard_size[UUID_REGISTRY_SHARD_COUNT];
+
+				std::vector<uuid_reg_ent_t> m_shard_table[UUID_REGISTRY_SHARD_COUNT];
+
+				uuid_reg_t m_type;
 
 			private:
 
 				std::recursive_mutex m_lock;
 
-		} uuid, *uuid_ptr;
-
-		bool operator<(
-			__in const uuid &left,
-			__in const uuid &right
-			);
+		} uuid_registry, *uuid_registry_ptr;
 
 		void uuid_factory_destroy(void);
 
@@ -135,12 +269,25 @@ namespace LUNA_NS {
 					__in_opt bool unique = false
 					);
 
+				uuid generate_range(
+					__in size_t count
+					);
+
 				size_t get_reference_count(
 					__in const uuid &id
 					);
 
+				uuid_gen_t get_generator_type(void);
+
+				uuid_ref_t get_reference_type(void);
+
+				uuid_reg_t get_registry_type(void);
+
 				void initialize(
-					__in uint32_t seed
+					__in uint32_t seed,
+					__in_opt uuid_reg_t registry = UUID_REGISTRY_SHARDED,
+					__in_opt uuid_gen_t generator = UUID_GENERATOR_RANDOM,
+					__in_opt uuid_ref_t reference = UUID_REFERENCE_INTRUSIVE
 					);
 
 				bool is_initialized(void);
@@ -168,6 +315,11 @@ namespace LUNA_NS {
 					__in const uuid &id
 					);
 
+				void unregister_range(
+					__in const uuid &id,
+					__in size_t count
+					);
+
 			protected:
 
 				friend void uuid_factory_destroy(void);
@@ -186,22 +338,28 @@ namespace LUNA_NS {
 					__in const _uuid_factory &other
 					);
 
-				std::map<uuid, uuid_config_t>::iterator find_id(
-					__in const uuid &id
-					);
-
 				uuid_blk_t generate_block(void);
 
+				uuid_blk_t generate_sequential_block(void);
+
+				std::atomic<uint64_t> m_counter;
+
 				std::uniform_int_distribution<uint32_t> m_distribution;
 
+				std::atomic<uint32_t> m_epoch;
+
 				std::mt19937 m_generator;
 
-				std::map<uuid, uuid_config_t> m_id_map;
+				uuid_gen_t m_generator_type;
 
 				bool m_initialized;
 
 				static _uuid_factory *m_instance;
 
+				uuid_ref_t m_reference_type;
+
+				uuid_registry m_registry;
+
 				uint32_t m_seed;
 
 			private:
@@ -238,8 +396,12 @@ namespace LUNA_NS {
 
 				void generate_id(void);
 
+				void release_id(void);
+
 				uuid m_id;
 
+				uuid_ref_cnt_ptr_t m_reference;
+
 			private:
 
 				std::recursive_mutex m_lock;
@@ -248,4 +410,17 @@ namespace LUNA_NS {
 	}
 }
 
+namespace std {
+
+	template <> struct hash<LUNA_NS::LUNA_COMP_NS::uuid> {
+
+		size_t operator()(
+			__in const LUNA_NS::LUNA_COMP_NS::uuid &id
+			) const
+		{
+			return id.hash();
+		}
+	};
+}
+
 #endif // LUNA_UUID_H_
@@ -28,6 +28,10 @@ namespace LUNA_NS {
 			LUNA_UUID_EXCEPTION_ACQUIRY_FAILED = 0,
 			LUNA_UUID_EXCEPTION_ALLOC_FAILED,
 			LUNA_UUID_EXCEPTION_ID_NOT_FOUND,
+			LUNA_UUID_EXCEPTION_INVALID_GENERATOR,
+			LUNA_UUID_EXCEPTION_INVALID_RANGE,
+			LUNA_UUID_EXCEPTION_INVALID_REFERENCE,
+			LUNA_UUID_EXCEPTION_INVALID_REGISTRY,
 			LUNA_UUID_EXCEPTION_LIBARY_ACQUIRY_FAILED,
 			LUNA_UUID_EXCEPTION_UNINITIALIZED,
 			LUNA_UUID_EXCEPTION_UNIQUE_ID_REFERENCED,
@@ -37,6 +41,10 @@ namespace LUNA_NS {
 			"Failed to acquire UUID factory",
 			"UUID factory allocation failed",
 			"UUID not found",
+			"Invalid UUID generator type",
+			"Invalid UUID range length",
+			"Invalid UUID reference type",
+			"Invalid UUID registry type",
 			"Failed to acquire library",
 			"UUID factory is uninitialized",
 			"Unique UUID referenced multiple times",
@@ -54,6 +62,9 @@ namespace LUNA_NS {
 		class _uuid;
 		typedef _uuid uuid, *uuid_ptr;
 
+		class _uuid_registry;
+		typedef _uuid_registry uuid_registry, *uuid_registry_ptr;
+
 		class _uuid_factory;
 		typedef _uuid_factory uuid_factory, *uuid_factory_ptr;
 
@@ -0,0 +1,611 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include "luna.h"
+#include "luna_value_type.h"
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		static const std::string VALUE_TAG_STR[] = {
+			"BOOLEAN", "FLOAT", "INTEGER", "NULL", "REFERENCE",
+			};
+
+		#define VALUE_TAG_STRING(_TYPE_)\
+			((_TYPE_) > VALUE_TAG_MAX ? UNKNOWN : VALUE_TAG_STR[_TYPE_].c_str())
+
+		#define VALUE_BOX(_TAG_, _PAYLOAD_)\
+			(VALUE_BOX_BASE | (((uint64_t) (_TAG_)) << VALUE_TAG_SHIFT) | ((_PAYLOAD_) & VALUE_PAYLOAD_MASK))
+		#define VALUE_IS_BOXED(_BITS_) (((_BITS_) & VALUE_BOX_BASE) == VALUE_BOX_BASE)
+		#define VALUE_PAYLOAD(_BITS_) ((_BITS_) & VALUE_PAYLOAD_MASK)
+		#define VALUE_TAG(_BITS_) ((value_tag_t) (((_BITS_) >> VALUE_TAG_SHIFT) & VALUE_TAG_MASK))
+
+		#define VALUE_INTEGER_WRAP(_VALUE_) ((int) (uint32_t) (_VALUE_))
+
+		_value::_value(void) :
+				m_bits(VALUE_BOX(VALUE_TAG_NULL, 0))
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value::_value(
+			__in bool val
+			) :
+				m_bits(VALUE_BOX(VALUE_TAG_BOOLEAN, val ? 1 : 0))
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value::_value(
+			__in double val
+			)
+		{
+			TRACE_ENTRY();
+
+			if(std::isnan(val)) {
+				m_bits = VALUE_BOX_NAN;
+			} else {
+				std::memcpy(&m_bits, &val, sizeof(m_bits));
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value::_value(
+			__in int val
+			) :
+				m_bits(VALUE_BOX(VALUE_TAG_INTEGER, (uint32_t) val))
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value::_value(
+			__in symbol_ptr sym
+			)
+		{
+			TRACE_ENTRY();
+
+			if(!sym) {
+				THROW_LUNA_VALUE_EXCEPTION(LUNA_VALUE_EXCEPTION_INVALID_SYMBOL);
+			}
+
+			if(((uint64_t) sym) & ~VALUE_PAYLOAD_MASK) {
+				THROW_LUNA_VALUE_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_INVALID_REFERENCE,
+					"%p", sym);
+			}
+
+			m_bits = VALUE_BOX(VALUE_TAG_REFERENCE, (uint64_t) sym);
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value::_value(
+			__in value_tag_t tag,
+			__in uint64_t payload
+			) :
+				m_bits(VALUE_BOX(tag, payload))
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value 
+		_value::add(
+			__in const _value &other
+			) const
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(is_integer() && other.is_integer()) {
+				result = _value(VALUE_INTEGER_WRAP((uint32_t) as_integer() + (uint32_t) other.as_integer()));
+			} else {
+				result = _value(as_number() + other.as_number());
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		bool 
+		_value::as_boolean(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			if(!is_boolean()) {
+				THROW_LUNA_VALUE_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_INVALID_TYPE,
+					"%s", VALUE_TAG_STRING(get_tag()));
+			}
+
+			result = (VALUE_PAYLOAD(m_bits) != 0);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		double 
+		_value::as_float(void) const
+		{
+			double result;
+
+			TRACE_ENTRY();
+
+			if(!is_float()) {
+				THROW_LUNA_VALUE_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_INVALID_TYPE,
+					"%s", VALUE_TAG_STRING(get_tag()));
+			}
+
+			std::memcpy(&result, &m_bits, sizeof(result));
+
+			TRACE_EXIT("Return Value: %f", result);
+			return result;
+		}
+
+		int 
+		_value::as_integer(void) const
+		{
+			int result;
+
+			TRACE_ENTRY();
+
+			if(!is_integer()) {
+				THROW_LUNA_VALUE_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_INVALID_TYPE,
+					"%s", VALUE_TAG_STRING(get_tag()));
+			}
+
+			result = VALUE_INTEGER_WRAP(VALUE_PAYLOAD(m_bits));
+
+			TRACE_EXIT("Return Value: %i", result);
+			return result;
+		}
+
+		double 
+		_value::as_number(void) const
+		{
+			double result;
+
+			TRACE_ENTRY();
+
+			if(is_integer()) {
+				result = as_integer();
+			} else {
+				result = as_float();
+			}
+
+			TRACE_EXIT("Return Value: %f", result);
+			return result;
+		}
+
+		symbol_ptr 
+		_value::as_reference(void) const
+		{
+			symbol_ptr result;
+
+			TRACE_ENTRY();
+
+			if(!is_reference()) {
+				THROW_LUNA_VALUE_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_INVALID_TYPE,
+					"%s", VALUE_TAG_STRING(get_tag()));
+			}
+
+			result = (symbol_ptr) VALUE_PAYLOAD(m_bits);
+
+			TRACE_EXIT("Return Value: 0x%p", result);
+			return result;
+		}
+
+		_value 
+		_value::divide(
+			__in const _value &other
+			) const
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(is_integer() && other.is_integer()) {
+
+				if(!other.as_integer()) {
+					THROW_LUNA_VALUE_EXCEPTION(LUNA_VALUE_EXCEPTION_DIVIDE_BY_ZERO);
+				}
+
+				if((as_integer() == INT_MIN) && (other.as_integer() == -1)) {
+					result = _value(INT_MIN);
+				} else {
+					result = _value(as_integer() / other.as_integer());
+				}
+			} else {
+				result = _value(as_number() / other.as_number());
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		_value 
+		_value::from_symbol(
+			__in symbol_ptr sym
+			)
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(!sym) {
+				THROW_LUNA_VALUE_EXCEPTION(LUNA_VALUE_EXCEPTION_INVALID_SYMBOL);
+			}
+
+			switch(sym->get_type()) {
+				case SCOPE_SYMBOL_BOOLEAN:
+					result = _value(((symbol_boolean_ptr) sym)->get_value());
+					break;
+				case SCOPE_SYMBOL_FLOAT:
+					result = _value(((symbol_float_ptr) sym)->get_value());
+					break;
+				case SCOPE_SYMBOL_INTEGER:
+					result = _value(((symbol_integer_ptr) sym)->get_value());
+					break;
+				case SCOPE_SYMBOL_NULL:
+					break;
+				default:
+					result = _value(sym);
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		uint64_t 
+		_value::get_bits(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT("Return Value: 0x%llx", m_bits);
+			return m_bits;
+		}
+
+		value_tag_t 
+		_value::get_tag(void) const
+		{
+			value_tag_t result = VALUE_TAG_FLOAT;
+
+			TRACE_ENTRY();
+
+			if(VALUE_IS_BOXED(m_bits)) {
+				result = VALUE_TAG(m_bits);
+			}
+
+			TRACE_EXIT("Return Value: %s", VALUE_TAG_STRING(result));
+			return result;
+		}
+
+		scope_sym_t 
+		_value::get_type(void) const
+		{
+			scope_sym_t result;
+
+			TRACE_ENTRY();
+
+			switch(get_tag()) {
+				case VALUE_TAG_BOOLEAN:
+					result = SCOPE_SYMBOL_BOOLEAN;
+					break;
+				case VALUE_TAG_FLOAT:
+					result = SCOPE_SYMBOL_FLOAT;
+					break;
+				case VALUE_TAG_INTEGER:
+					result = SCOPE_SYMBOL_INTEGER;
+					break;
+				case VALUE_TAG_NULL:
+					result = SCOPE_SYMBOL_NULL;
+					break;
+				default:
+					result = as_reference()->get_type();
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_boolean(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = (VALUE_IS_BOXED(m_bits) && (VALUE_TAG(m_bits) == VALUE_TAG_BOOLEAN));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_equal(
+			__in const _value &other
+			) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			if(is_numeric() && other.is_numeric()) {
+
+				if(is_integer() && other.is_integer()) {
+					result = (m_bits == other.m_bits);
+				} else {
+					result = (as_number() == other.as_number());
+				}
+			} else {
+				result = (m_bits == other.m_bits);
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_float(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = !VALUE_IS_BOXED(m_bits);
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_integer(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = (VALUE_IS_BOXED(m_bits) && (VALUE_TAG(m_bits) == VALUE_TAG_INTEGER));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_less(
+			__in const _value &other
+			) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			if(is_integer() && other.is_integer()) {
+				result = (as_integer() < other.as_integer());
+			} else {
+				result = (as_number() < other.as_number());
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_null(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = (VALUE_IS_BOXED(m_bits) && (VALUE_TAG(m_bits) == VALUE_TAG_NULL));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_numeric(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = (is_float() || is_integer());
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_value::is_reference(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = (VALUE_IS_BOXED(m_bits) && (VALUE_TAG(m_bits) == VALUE_TAG_REFERENCE));
+
+			TRACE_EXIT("Return Value: 0x%x", result);
+			return result;
+		}
+
+		_value 
+		_value::modulus(
+			__in const _value &other
+			) const
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(is_integer() && other.is_integer()) {
+
+				if(!other.as_integer()) {
+					THROW_LUNA_VALUE_EXCEPTION(LUNA_VALUE_EXCEPTION_DIVIDE_BY_ZERO);
+				}
+
+				if(other.as_integer() == -1) {
+					result = _value(0);
+				} else {
+					result = _value(as_integer() % other.as_integer());
+				}
+			} else {
+				result = _value(std::fmod(as_number(), other.as_number()));
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		_value 
+		_value::multiply(
+			__in const _value &other
+			) const
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(is_integer() && other.is_integer()) {
+				result = _value(VALUE_INTEGER_WRAP((uint32_t) as_integer() * (uint32_t) other.as_integer()));
+			} else {
+				result = _value(as_number() * other.as_number());
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		_value 
+		_value::negate(void) const
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(is_integer()) {
+				result = _value(VALUE_INTEGER_WRAP(0 - (uint32_t) as_integer()));
+			} else {
+				result = _value(-as_float());
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		void 
+		_value::store(
+			__in symbol_ptr sym
+			) const
+		{
+			TRACE_ENTRY();
+
+			if(!sym) {
+				THROW_LUNA_VALUE_EXCEPTION(LUNA_VALUE_EXCEPTION_INVALID_SYMBOL);
+			}
+
+			if(is_reference() || (sym->get_type() != get_type())) {
+				THROW_LUNA_VALUE_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_INVALID_TYPE,
+					"%s", VALUE_TAG_STRING(get_tag()));
+			}
+
+			switch(get_tag()) {
+				case VALUE_TAG_BOOLEAN:
+					((symbol_boolean_ptr) sym)->set_value(as_boolean());
+					break;
+				case VALUE_TAG_FLOAT:
+					((symbol_float_ptr) sym)->set_value(as_float());
+					break;
+				case VALUE_TAG_INTEGER:
+					((symbol_integer_ptr) sym)->set_value(as_integer());
+					break;
+				default:
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+		}
+
+		_value 
+		_value::subtract(
+			__in const _value &other
+			) const
+		{
+			_value result;
+
+			TRACE_ENTRY();
+
+			if(is_integer() && other.is_integer()) {
+				result = _value(VALUE_INTEGER_WRAP((uint32_t) as_integer() - (uint32_t) other.as_integer()));
+			} else {
+				result = _value(as_number() - other.as_number());
+			}
+
+			TRACE_EXIT("Return Value: 0x%llx", result.m_bits);
+			return result;
+		}
+
+		std::string 
+		_value::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY();
+
+			if(verbose) {
+				result << "(0x" << VALUE_AS_HEX(uint64_t, m_bits) << ") ";
+			}
+
+			result << "[" << VALUE_TAG_STRING(get_tag()) << "] ";
+
+			switch(get_tag()) {
+				case VALUE_TAG_BOOLEAN:
+					result << (as_boolean() ? "true" : "false");
+					break;
+				case VALUE_TAG_FLOAT:
+					result << as_float();
+					break;
+				case VALUE_TAG_INTEGER:
+					result << as_integer();
+					break;
+				case VALUE_TAG_NULL:
+					result << "null";
+					break;
+				default:
+					result << scope::symbol_as_string(as_reference(), verbose);
+					break;
+			}
+
+			TRACE_EXIT("Return Value: 0x%x", NULL);
+			return result.str();
+		}
+	}
+}
@@ -0,0 +1,153 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_VALUE_H_
+#define LUNA_VALUE_H_
+
+#include <type_traits>
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		typedef enum {
+			VALUE_TAG_BOOLEAN = 0,
+			VALUE_TAG_FLOAT,
+			VALUE_TAG_INTEGER,
+			VALUE_TAG_NULL,
+			VALUE_TAG_REFERENCE,
+		} value_tag_t;
+
+		#define VALUE_TAG_MAX VALUE_TAG_REFERENCE
+
+		#define VALUE_BOX_BASE 0xfff8000000000000ULL
+		#define VALUE_BOX_NAN 0x7ff8000000000000ULL
+		#define VALUE_PAYLOAD_MASK 0x0000ffffffffffffULL
+		#define VALUE_TAG_MASK 0x07
+		#define VALUE_TAG_SHIFT 48
+
+		typedef class _value {
+
+			public:
+
+				_value(void);
+
+				_value(
+					__in bool val
+					);
+
+				_value(
+					__in double val
+					);
+
+				_value(
+					__in int val
+					);
+
+				_value(
+					__in symbol_ptr sym
+					);
+
+				_value add(
+					__in const _value &other
+					) const;
+
+				bool as_boolean(void) const;
+
+				double as_float(void) const;
+
+				int as_integer(void) const;
+
+				double as_number(void) const;
+
+				symbol_ptr as_reference(void) const;
+
+				_value divide(
+					__in const _value &other
+					) const;
+
+				static _value from_symbol(
+					__in symbol_ptr sym
+					);
+
+				uint64_t get_bits(void) const;
+
+				value_tag_t get_tag(void) const;
+
+				scope_sym_t get_type(void) const;
+
+				bool is_boolean(void) const;
+
+				bool is_equal(
+					__in const _value &other
+					) const;
+
+				bool is_float(void) const;
+
+				bool is_integer(void) const;
+
+				bool is_less(
+					__in const _value &other
+					) const;
+
+				bool is_null(void) const;
+
+				bool is_numeric(void) const;
+
+				bool is_reference(void) const;
+
+				_value modulus(
+					__in const _value &other
+					) const;
+
+				_value multiply(
+					__in const _value &other
+					) const;
+
+				_value negate(void) const;
+
+				void store(
+					__in symbol_ptr sym
+					) const;
+
+				_value subtract(
+					__in const _value &other
+					) const;
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+			protected:
+
+				_value(
+					__in value_tag_t tag,
+					__in uint64_t payload
+					);
+
+				uint64_t m_bits;
+
+		} value, *value_ptr;
+
+		static_assert(std::is_trivially_copyable<value>::value && (sizeof(value) == sizeof(uint64_t)),
+			"value must be a trivially copyable 64-bit word");
+	}
+}
+
+#endif // LUNA_VALUE_H_
@@ -0,0 +1,55 @@
+/*
+ * Project Luna
+ * Copyright (C) 2014 David Jolly
+ * ----------------------
+ *
+ * Luna is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Luna is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUNA_VALUE_TYPE_H_
+#define LUNA_VALUE_TYPE_H_
+
+namespace LUNA_NS {
+
+	namespace LUNA_COMP_NS {
+
+		enum {
+			LUNA_VALUE_EXCEPTION_DIVIDE_BY_ZERO = 0,
+			LUNA_VALUE_EXCEPTION_INVALID_REFERENCE,
+			LUNA_VALUE_EXCEPTION_INVALID_SYMBOL,
+			LUNA_VALUE_EXCEPTION_INVALID_TYPE,
+		};
+
+		static const std::string LUNA_VALUE_EXCEPTION_STR[] = {
+			"Value division by zero",
+			"Reference does not fit in a boxed value",
+			"Symbol is not allocated",
+			"Invalid value type",
+			};
+
+		#define LUNA_VALUE_EXCEPTION_MAX LUNA_VALUE_EXCEPTION_INVALID_TYPE
+
+		#define LUNA_VALUE_EXCEPTION_STRING(_EXCEPT_)\
+			((_EXCEPT_) > LUNA_VALUE_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : LUNA_VALUE_EXCEPTION_STR[_EXCEPT_].c_str())
+		#define THROW_LUNA_VALUE_EXCEPTION(_EXCEPT_)\
+			THROW_EXCEPTION(LUNA_VALUE_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_LUNA_VALUE_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...)\
+			THROW_EXCEPTION_MESSAGE(LUNA_VALUE_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _value;
+		typedef _value value, *value_ptr;
+	}
+}
+
+#endif // LUNA_VALUE_TYPE_H_